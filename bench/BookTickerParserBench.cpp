@@ -0,0 +1,86 @@
+// Compares the in-place bookTicker scanner against the nlohmann DOM path
+// on synthetic Binance combined-stream frames.
+//
+//   bookticker_bench [iterations]
+
+#include "exchange/BookTickerParser.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    std::vector<std::string> makeFrames(size_t count) {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<double> priceMove(-5.0, 5.0);
+        std::uniform_real_distribution<double> qty(0.001, 12.0);
+
+        std::vector<std::string> frames;
+        frames.reserve(count);
+
+        double mid = 108000.0;
+        for (size_t i = 0; i < count; ++i) {
+            mid += priceMove(rng);
+            std::ostringstream oss;
+            oss << std::fixed << std::setprecision(8)
+                << R"({"stream":"btcusdt@bookTicker","data":{"u":)" << (70000000000ULL + i)
+                << R"(,"s":"BTCUSDT","b":")" << (mid - 0.01)
+                << R"(","B":")" << qty(rng)
+                << R"(","a":")" << (mid + 0.01)
+                << R"(","A":")" << qty(rng) << R"("}})";
+            frames.push_back(oss.str());
+        }
+        return frames;
+    }
+
+    template <typename ParseFn>
+    double framesPerSecond(const std::vector<std::string>& frames, size_t iterations, ParseFn parseFn, double& checksum) {
+        OrderBookUpdate update;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t it = 0; it < iterations; ++it) {
+            for (const auto& frame : frames) {
+                parseFn(frame, update);
+                checksum += update.bestBid + update.bestAskQty;
+            }
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return (frames.size() * iterations) / elapsed.count();
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t iterations = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200;
+    auto frames = makeFrames(1000);
+
+    // Sanity check: both paths must agree on every frame.
+    for (const auto& frame : frames) {
+        OrderBookUpdate fast, slow;
+        if (!BookTickerParser::parse(frame, fast) || !BookTickerParser::parseWithJson(frame, slow) ||
+            fast.symbol != slow.symbol || fast.bestBid != slow.bestBid || fast.bestAsk != slow.bestAsk ||
+            fast.bestBidQty != slow.bestBidQty || fast.bestAskQty != slow.bestAskQty) {
+            std::cerr << "❌ Parser mismatch on frame: " << frame << "\n";
+            return 1;
+        }
+    }
+
+    double checksumJson = 0.0, checksumFast = 0.0;
+    double jsonRate = framesPerSecond(frames, iterations, [](const std::string& f, OrderBookUpdate& u) {
+        BookTickerParser::parseWithJson(f, u);
+    }, checksumJson);
+    double fastRate = framesPerSecond(frames, iterations, [](const std::string& f, OrderBookUpdate& u) {
+        BookTickerParser::parse(f, u);
+    }, checksumFast);
+
+    std::cout << std::fixed << std::setprecision(0);
+    std::cout << "📊 bookTicker parser benchmark (" << frames.size() * iterations << " frames)\n";
+    std::cout << "   ➤ nlohmann::json : " << jsonRate << " frames/sec\n";
+    std::cout << "   ➤ in-place scan  : " << fastRate << " frames/sec\n";
+    std::cout << std::setprecision(2);
+    std::cout << "   ➤ Speedup        : " << fastRate / jsonRate << "x\n";
+
+    return checksumJson == checksumFast ? 0 : 1;
+}
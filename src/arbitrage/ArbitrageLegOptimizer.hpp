@@ -4,7 +4,7 @@
 
 class ArbitrageLegOptimizer {
 public:
-    static double computeCapitalLimit(const OrderBookUpdate& longLeg, const OrderBookUpdate& shortLeg, double maxCapital) {
+    static double computeCapitalLimit(const TopOfBook& longLeg, const TopOfBook& shortLeg, double maxCapital) {
         // Defensive checks for invalid inputs
         if (longLeg.bestAsk <= 0 || longLeg.bestAskQty <= 0 || 
             shortLeg.bestBid <= 0 || shortLeg.bestBidQty <= 0) {
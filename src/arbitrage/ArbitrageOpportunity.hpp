@@ -1,6 +1,7 @@
 #pragma once
 #include <string>
 #include <sstream>
+#include <vector>
 #include "exchange/MarketDataTypes.hpp"
  
 struct ArbitrageOpportunity {
@@ -14,8 +15,8 @@ struct ArbitrageOpportunity {
     double shortPrice = 0.0;
     double profitPercentage = 0.0;
     double capital = 0.0;
-    OrderBookUpdate longBook;
-    OrderBookUpdate shortBook;
+    TopOfBook longBook;
+    TopOfBook shortBook;
     std::string describe() const {
         std::ostringstream oss;
         oss << "💰 Arbitrage Opportunity: [" << symbol << "]\n"
@@ -28,3 +29,37 @@ struct ArbitrageOpportunity {
         return oss.str();
     }
 };
+
+// One conversion of a multi-leg opportunity: buy `symbol`'s base with its
+// quote at the ask, or sell the base for the quote at the bid.
+struct ArbitrageLeg {
+    std::string exchange;
+    std::string symbol;
+    bool buy = true;
+    double price = 0.0;
+    double qty = 0.0;   // base units quoted at `price`
+    double fee = 0.0;   // taker fee, fraction of notional
+};
+
+// Conversions executed back to back, starting and ending in `currency`
+// (e.g. USDT -> BTC -> ETH -> USDT on one venue).
+struct MultiLegOpportunity {
+    std::string route;
+    std::string currency;
+    std::vector<ArbitrageLeg> legs;
+    std::string strategyType = "unknown strategy";
+
+    double profitPercentage = 0.0; // after fees
+    double capital = 0.0;          // in `currency`
+    std::string describe() const {
+        std::ostringstream oss;
+        oss << "💰 Multi-Leg Opportunity: [" << route << "]\n";
+        for (const auto& leg : legs)
+            oss << (leg.buy ? "➡️ Buy " : "⬅️ Sell ") << leg.symbol << " on " << leg.exchange << " at " << leg.price << "\n";
+        oss << "📈 Profit: " << profitPercentage << "%\n"
+            << "💵 Capital Required: " << capital << " " << currency << "\n"
+            << "🔍 Strategy: " << strategyType << "\n";
+
+        return oss.str();
+    }
+};
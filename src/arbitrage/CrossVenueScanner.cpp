@@ -0,0 +1,153 @@
+#include "CrossVenueScanner.hpp"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+namespace {
+    constexpr int64_t NEVER = INT64_MIN / 2;
+    constexpr double UNUSABLE = std::numeric_limits<double>::infinity();
+
+    int64_t toNs(MonoTimestamp t) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+    }
+}
+
+CrossVenueScanner::CrossVenueScanner(const QuoteFreshness& freshness, double minEdgeBps, int instruments)
+    : freshness(freshness),
+      hurdleFactor(1.0 + minEdgeBps / 10000.0),
+      capacity(instruments),
+      stride((static_cast<size_t>(instruments) + 7) / 8 * 8),
+      bid(MAX_VENUES * stride, 0.0),
+      ask(MAX_VENUES * stride, 0.0),
+      bidQty(MAX_VENUES * stride, 0.0),
+      askQty(MAX_VENUES * stride, 0.0),
+      fee(MAX_VENUES * stride, 0.0),
+      receivedNs(MAX_VENUES * stride, NEVER),
+      bestProceeds(stride, 0.0),
+      lowestHurdle(stride, UNUSABLE),
+      claimed(stride, ArbCandidate{0, -1, -1, 0.0f, 0.0f, 0.0, 0.0}) {}
+
+bool CrossVenueScanner::update(const TopOfBook& top) {
+    if (top.venue < 0 || top.venue >= MAX_VENUES) return false;
+    if (top.instrument < 0 || top.instrument >= capacity) return false;
+
+    const size_t cell = static_cast<size_t>(top.venue) * stride + top.instrument;
+    bid[cell] = top.bestBid;
+    ask[cell] = top.bestAsk;
+    bidQty[cell] = top.bestBidQty;
+    askQty[cell] = top.bestAskQty;
+    receivedNs[cell] = top.receiveTime != MonoTimestamp{} ? toNs(top.receiveTime) : toNs(std::chrono::steady_clock::now());
+
+    // Same test as ConsolidatedBook::checkCross: new, or moved venues or
+    // prices; once nothing clears, the next cross is new again
+    const ArbCandidate best = bestPair(top.instrument);
+    ArbCandidate& last = claimed[top.instrument];
+    if (best.buyVenue < 0) {
+        last.buyVenue = -1;
+        return false;
+    }
+    return !samePair(best, last);
+}
+
+ArbCandidate CrossVenueScanner::bestPair(InstrumentId instrument) const {
+    // Same pairing order and edge as scan(), so the strategy picks the same best
+    ArbCandidate best{instrument, -1, -1, 0.0f, 0.0f, 0.0, 0.0};
+    const int venues = std::min(InstrumentRegistry::venueCount(), MAX_VENUES);
+    const int64_t nowNs = toNs(freshness.now());
+    auto live = [&](VenueId v, size_t cell) {
+        return receivedNs[cell] >= nowNs - std::chrono::duration_cast<std::chrono::nanoseconds>(freshness.limit(v)).count();
+    };
+
+    for (VenueId buy = 0; buy < venues; ++buy) {
+        const size_t buyCell = static_cast<size_t>(buy) * stride + instrument;
+        if (!live(buy, buyCell) || ask[buyCell] <= 0.0) continue;
+        const double cost = ask[buyCell] * (1.0 + fee[buyCell]);
+
+        for (VenueId sell = 0; sell < venues; ++sell) {
+            const size_t sellCell = static_cast<size_t>(sell) * stride + instrument;
+            if (sell == buy || !live(sell, sellCell)) continue;
+            const double proceeds = bid[sellCell] * (1.0 - fee[sellCell]);
+            if (proceeds < cost * hurdleFactor) continue;
+            const float edge = static_cast<float>((proceeds - cost) / cost * 10000.0);
+            if (best.buyVenue >= 0 && !(edge > best.netEdgeBps)) continue;
+            best = {instrument, static_cast<int16_t>(buy), static_cast<int16_t>(sell), edge,
+                    static_cast<float>(std::min(askQty[buyCell], bidQty[sellCell])), ask[buyCell], bid[sellCell]};
+        }
+    }
+    return best;
+}
+
+bool CrossVenueScanner::claim(const ArbCandidate& candidate) {
+    if (candidate.instrument < 0 || candidate.instrument >= capacity) return false;
+    ArbCandidate& last = claimed[candidate.instrument];
+    if (samePair(candidate, last)) return false;
+    last = candidate;
+    return true;
+}
+
+void CrossVenueScanner::setFee(VenueId venue, InstrumentId instrument, double rate) {
+    if (venue < 0 || venue >= MAX_VENUES || instrument < 0 || instrument >= capacity) return;
+    fee[static_cast<size_t>(venue) * stride + instrument] = rate;
+}
+
+void CrossVenueScanner::setFee(VenueId venue, double rate) {
+    if (venue < 0 || venue >= MAX_VENUES) return;
+    std::fill_n(row(fee, venue), stride, rate);
+}
+
+std::span<const ArbCandidate> CrossVenueScanner::scan() {
+    candidates.clear();
+
+    const int venues = std::min(InstrumentRegistry::venueCount(), MAX_VENUES);
+    const size_t count = static_cast<size_t>(std::clamp(InstrumentRegistry::instrumentCount(), 0, capacity));
+    const int64_t nowNs = toNs(freshness.now());
+
+    // One pass per venue row: the best proceeds and the lowest hurdle (cost
+    // plus the minimum edge) of each instrument over all venues, with fees
+    // and staleness folded in; stale or missing quotes can never clear
+    std::fill_n(bestProceeds.begin(), count, 0.0);
+    std::fill_n(lowestHurdle.begin(), count, UNUSABLE);
+    double* best = bestProceeds.data();
+    double* lowest = lowestHurdle.data();
+
+    for (VenueId v = 0; v < venues; ++v) {
+        oldest[v] = nowNs - std::chrono::duration_cast<std::chrono::nanoseconds>(freshness.limit(v)).count();
+        const double* bids = row(bid, v);
+        const double* asks = row(ask, v);
+        const double* fees = row(fee, v);
+        const int64_t* times = receivedNs.data() + static_cast<size_t>(v) * stride;
+        const int64_t cutoff = oldest[v];
+
+        for (size_t i = 0; i < count; ++i) {
+            const bool live = times[i] >= cutoff;
+            const double sell = live ? bids[i] * (1.0 - fees[i]) : 0.0;
+            const double bar = live & (asks[i] > 0.0) ? asks[i] * (1.0 + fees[i]) * hurdleFactor : UNUSABLE;
+            best[i] = std::max(best[i], sell);
+            lowest[i] = std::min(lowest[i], bar);
+        }
+    }
+
+    // Some ordered venue pair clears exactly where the best proceeds reach
+    // the lowest hurdle; only those instruments are paired up
+    for (size_t i = 0; i < count; ++i) {
+        if (best[i] < lowest[i]) continue;
+
+        for (VenueId buy = 0; buy < venues; ++buy) {
+            const size_t buyCell = static_cast<size_t>(buy) * stride + i;
+            if (receivedNs[buyCell] < oldest[buy] || ask[buyCell] <= 0.0) continue;
+            const double cost = ask[buyCell] * (1.0 + fee[buyCell]);
+
+            for (VenueId sell = 0; sell < venues; ++sell) {
+                const size_t sellCell = static_cast<size_t>(sell) * stride + i;
+                if (sell == buy || receivedNs[sellCell] < oldest[sell]) continue;
+                const double proceeds = bid[sellCell] * (1.0 - fee[sellCell]);
+                if (proceeds < cost * hurdleFactor) continue;
+                candidates.push_back({static_cast<InstrumentId>(i), static_cast<int16_t>(buy), static_cast<int16_t>(sell),
+                                      static_cast<float>((proceeds - cost) / cost * 10000.0),
+                                      static_cast<float>(std::min(askQty[buyCell], bidQty[sellCell])),
+                                      ask[buyCell], bid[sellCell]});
+            }
+        }
+    }
+    return candidates;
+}
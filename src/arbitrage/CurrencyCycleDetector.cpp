@@ -0,0 +1,214 @@
+#include "CurrencyCycleDetector.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <map>
+
+namespace {
+    constexpr double UNQUOTED = std::numeric_limits<double>::infinity();
+    constexpr double NOT_EMITTED = std::numeric_limits<double>::quiet_NaN();
+}
+
+CurrencyCycleDetector::CurrencyCycleDetector(const QuoteFreshness& freshness, double minEdgeBps, const std::string& home)
+    : freshness(freshness),
+      threshold(-std::log1p(minEdgeBps / 10000.0)),
+      home(currencies.add(home)),
+      marketEdges(static_cast<size_t>(InstrumentRegistry::MAX_VENUES) * InstrumentRegistry::MAX_INSTRUMENTS, NO_MARKET) {}
+
+void CurrencyCycleDetector::setFee(VenueId venue, double fee) {
+    if (venue < 0 || venue >= InstrumentRegistry::MAX_VENUES) return;
+    fees[venue] = fee;
+}
+
+void CurrencyCycleDetector::setSpot(VenueId venue, bool spot) {
+    if (venue < 0 || venue >= InstrumentRegistry::MAX_VENUES) return;
+    derivatives[venue] = !spot;
+}
+
+int CurrencyCycleDetector::addMarket(VenueId venue, InstrumentId instrument) {
+    if (derivatives[venue]) return NOT_A_PAIR;
+    const std::string& name = InstrumentRegistry::instrumentName(instrument);
+    const size_t slash = name.find('/');
+    if (slash == std::string::npos || slash == 0 || slash + 1 == name.size()) return NOT_A_PAIR;
+
+    const int base = currencies.add(std::string_view(name).substr(0, slash));
+    const int quote = currencies.add(std::string_view(name).substr(slash + 1));
+    const int first = static_cast<int>(edges.size());
+    edges.push_back({venue, instrument, true, quote, base});
+    edges.push_back({venue, instrument, false, base, quote});
+    weights.resize(edges.size(), UNQUOTED);
+    prices.resize(edges.size(), 0.0);
+    sizes.resize(edges.size(), 0.0);
+    compiled = false;
+    return first;
+}
+
+void CurrencyCycleDetector::enumerate(VenueId venue, int at, std::vector<int>& path, std::vector<bool>& visited) {
+    for (int e = 0; e < static_cast<int>(edges.size()); ++e) {
+        const Edge& edge = edges[e];
+        if (edge.venue != venue || edge.from != at) continue;
+
+        if (edge.to == home) {
+            // Two legs would just buy and sell the same pair back
+            if (path.size() + 1 < 3) continue;
+            path.push_back(e);
+            cycleEdges.insert(cycleEdges.end(), path.begin(), path.end());
+            cycleOffsets.push_back(static_cast<int>(cycleEdges.size()));
+            path.pop_back();
+        } else if (!visited[edge.to] && path.size() + 1 < MAX_HOPS) {
+            visited[edge.to] = true;
+            path.push_back(e);
+            enumerate(venue, edge.to, path, visited);
+            path.pop_back();
+            visited[edge.to] = false;
+        }
+    }
+}
+
+bool CurrencyCycleDetector::compile() {
+    // Edge ids survive a rebuild but cycle ids don't: carry what was handed
+    // out over by edge list
+    std::map<std::vector<int>, double> emitted;
+    for (int cycle = 0; cycle + 1 < static_cast<int>(cycleOffsets.size()); ++cycle) {
+        if (std::isnan(emittedWeight[cycle])) continue;
+        emitted.emplace(std::vector<int>(cycleEdges.begin() + cycleOffsets[cycle], cycleEdges.begin() + cycleOffsets[cycle + 1]),
+                        emittedWeight[cycle]);
+    }
+
+    cycleOffsets.assign(1, 0);
+    cycleEdges.clear();
+    std::vector<int> path;
+    std::vector<bool> visited(currencies.size(), false);
+    for (VenueId venue = 0; venue < InstrumentRegistry::MAX_VENUES; ++venue) {
+        visited[home] = true;
+        enumerate(venue, home, path, visited);
+    }
+    const int cycles = static_cast<int>(cycleOffsets.size()) - 1;
+
+    const int count = static_cast<int>(edges.size());
+    edgeCycleOffsets.assign(count + 1, 0);
+    for (int e : cycleEdges) ++edgeCycleOffsets[e + 1];
+    for (int e = 0; e < count; ++e) edgeCycleOffsets[e + 1] += edgeCycleOffsets[e];
+
+    edgeCycles.resize(cycleEdges.size());
+    std::vector<int> fill(edgeCycleOffsets.begin(), edgeCycleOffsets.end() - 1);
+    for (int cycle = 0; cycle < cycles; ++cycle)
+        for (int i = cycleOffsets[cycle]; i < cycleOffsets[cycle + 1]; ++i) edgeCycles[fill[cycleEdges[i]]++] = cycle;
+
+    // Cycles that cleared before the new pair (flagged or not) still do
+    flagged.assign(cycles, 0);
+    pending.clear();
+    emittedWeight.assign(cycles, NOT_EMITTED);
+    bool flaggedAny = false;
+    for (int cycle = 0; cycle < cycles; ++cycle) {
+        auto it = emitted.find(std::vector<int>(cycleEdges.begin() + cycleOffsets[cycle], cycleEdges.begin() + cycleOffsets[cycle + 1]));
+        if (it != emitted.end()) emittedWeight[cycle] = it->second;
+        flagIfNew(cycle, cycleWeight(cycle), flaggedAny);
+    }
+    compiled = true;
+    return flaggedAny;
+}
+
+double CurrencyCycleDetector::cycleWeight(int cycle) const {
+    double sum = 0.0;
+    for (int i = cycleOffsets[cycle]; i < cycleOffsets[cycle + 1]; ++i) sum += weights[cycleEdges[i]];
+    return sum;
+}
+
+void CurrencyCycleDetector::flagIfNew(int cycle, double weight, bool& flaggedAny) {
+    if (weight >= threshold) {
+        emittedWeight[cycle] = NOT_EMITTED; // it may come back at the same weight
+        return;
+    }
+    if (flagged[cycle] || weight == emittedWeight[cycle]) return;
+    flagged[cycle] = 1;
+    pending.push_back(cycle);
+    flaggedAny = true;
+}
+
+void CurrencyCycleDetector::evaluate(int edge, bool& flaggedAny) {
+    for (int i = edgeCycleOffsets[edge]; i < edgeCycleOffsets[edge + 1]; ++i) {
+        const int cycle = edgeCycles[i];
+        ++evaluations;
+        flagIfNew(cycle, cycleWeight(cycle), flaggedAny);
+    }
+}
+
+bool CurrencyCycleDetector::update(const TopOfBook& top) {
+    if (top.venue < 0 || top.venue >= InstrumentRegistry::MAX_VENUES) return false;
+    if (top.instrument < 0 || top.instrument >= InstrumentRegistry::MAX_INSTRUMENTS) return false;
+    if (top.bestBid <= 0 || top.bestAsk <= 0) return false;
+
+    int& market = marketEdges[static_cast<size_t>(top.venue) * InstrumentRegistry::MAX_INSTRUMENTS + top.instrument];
+    if (market == NO_MARKET) market = addMarket(top.venue, top.instrument);
+    if (market == NOT_A_PAIR) return false;
+    bool flaggedAny = false;
+    if (!compiled) flaggedAny = compile();
+
+    // Buying turns 1 quote into (1 - fee) / ask base; selling 1 base into bid * (1 - fee) quote
+    const double keep = std::log1p(-fees[top.venue]);
+    const int buy = market, sell = market + 1;
+    weights[buy] = std::log(top.bestAsk) - keep;
+    weights[sell] = -std::log(top.bestBid) - keep;
+    prices[buy] = top.bestAsk;
+    prices[sell] = top.bestBid;
+    sizes[buy] = top.bestAskQty;
+    sizes[sell] = top.bestBidQty;
+
+    evaluate(buy, flaggedAny);
+    evaluate(sell, flaggedAny);
+    return flaggedAny;
+}
+
+std::vector<MultiLegOpportunity> CurrencyCycleDetector::opportunities(double maxCapital) {
+    std::vector<MultiLegOpportunity> found;
+    for (int cycle : pending) {
+        flagged[cycle] = 0;
+
+        // Later quotes may have closed it again
+        const double weight = cycleWeight(cycle);
+        if (weight >= threshold) continue;
+
+        MultiLegOpportunity opp;
+        opp.currency = currencies.name(home);
+        opp.route = opp.currency;
+        opp.strategyType = "Currency Cycle Arbitrage";
+        opp.profitPercentage = std::expm1(-weight) * 100.0;
+
+        // Capacity: each leg's quoted size, in home currency at the rates before it
+        double rate = 1.0; // leg input currency per unit of home currency
+        double capital = maxCapital;
+        bool fresh = true;
+        for (int i = cycleOffsets[cycle]; i < cycleOffsets[cycle + 1]; ++i) {
+            const int e = cycleEdges[i];
+            const Edge& edge = edges[e];
+            fresh = fresh && freshness.areFresh(edge.instrument, QuoteFreshness::bit(edge.venue));
+
+            const double available = edge.buy ? sizes[e] * prices[e] : sizes[e];
+            capital = std::min(capital, available / rate);
+            rate *= std::exp(-weights[e]);
+
+            opp.legs.push_back({InstrumentRegistry::venueName(edge.venue), InstrumentRegistry::instrumentName(edge.instrument),
+                                edge.buy, prices[e], sizes[e], fees[edge.venue]});
+            opp.route += " → " + currencies.name(edge.to);
+        }
+        if (!fresh || capital <= 0.0) continue;
+
+        opp.capital = capital;
+        emittedWeight[cycle] = weight;
+        found.push_back(std::move(opp));
+    }
+    pending.clear();
+
+    std::sort(found.begin(), found.end(), [](const MultiLegOpportunity& a, const MultiLegOpportunity& b) {
+        return a.profitPercentage > b.profitPercentage;
+    });
+    return found;
+}
+
+void CurrencyCycleDetector::printStats() {
+    std::cout << "🔺 Currency cycles: " << (cycleOffsets.empty() ? 0 : cycleOffsets.size() - 1) << " cycles over "
+              << edges.size() / 2 << " pairs, " << evaluations << " cycle evaluations since last report\n";
+    evaluations = 0;
+}
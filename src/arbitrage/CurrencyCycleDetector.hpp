@@ -0,0 +1,109 @@
+#pragma once
+#include "exchange/MarketDataTypes.hpp"
+#include "exchange/InstrumentRegistry.hpp"
+#include "exchange/QuoteFreshness.hpp"
+#include "exchange/SymbolTable.hpp"
+#include "arbitrage/ArbitrageOpportunity.hpp"
+#include "arbitrage/CrossVenueScanner.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Triangular and multi-hop arbitrage: conversion cycles through the spot
+// pairs of one venue (USDT -> BTC -> ETH -> USDT) that return more than
+// they started with after taker fees.
+//
+// Each venue's pairs form a currency graph with two edges per pair: quote
+// to base at the ask and base to quote at the bid, weighted -log(rate after
+// fees), so a profitable cycle is a negative one. The graph only changes
+// when a pair is first seen, so every simple cycle through the home
+// currency, up to MAX_HOPS legs, is enumerated once then, along with the
+// cycles through each edge. A quote rewrites its pair's two weights and
+// re-sums only the cycles through them: no Bellman-Ford pass per tick.
+//
+// A clearing cycle is flagged once per weight: it is not handed out again
+// until a quote on one of its legs changes its weight (or it stops
+// clearing and comes back), so a persisting cycle is traded once.
+//
+// Pairs are picked up from the quotes themselves (any "BASE/QUOTE"
+// instrument on a spot venue). Updated and read on the dispatcher thread.
+class CurrencyCycleDetector {
+public:
+    static constexpr int MAX_HOPS = 4;
+
+    // Dispatcher key raised when update() returns true.
+    static constexpr int CYCLE_KEY = CrossVenueScanner::SCAN_KEY + 1;
+
+    // Cycles start and end in `home`; staleness limits come from `freshness`.
+    CurrencyCycleDetector(const QuoteFreshness& freshness, double minEdgeBps, const std::string& home = "USDT");
+
+    // Taker fee as a fraction of notional (0.001 = 10 bps) on every pair of the venue.
+    void setFee(VenueId venue, double fee);
+    // Whether the venue's quotes are spot pairs (default). Derivatives the
+    // registry names like spot pairs (Bybit's linear perps) convert nothing,
+    // so they stay out of the graph. Set before the venue's first quote.
+    void setSpot(VenueId venue, bool spot);
+
+    // True when the quote flags a cycle through its pair: one that clears
+    // minEdgeBps at a weight it was not handed out at.
+    bool update(const TopOfBook& top);
+
+    // Cycles flagged by update() since the last call that still clear with
+    // every leg fresh, best first. Capital is what the quoted sizes let
+    // through every leg, at most maxCapital (in the home currency).
+    std::vector<MultiLegOpportunity> opportunities(double maxCapital);
+
+    // Graph size and cycle evaluations since the last call.
+    void printStats();
+
+private:
+    static constexpr int NO_MARKET = -1;
+    static constexpr int NOT_A_PAIR = -2;
+
+    struct Edge {
+        VenueId venue;
+        InstrumentId instrument;
+        bool buy;
+        int from; // currency ids
+        int to;
+    };
+
+    int addMarket(VenueId venue, InstrumentId instrument);
+    bool compile(); // true if it re-flagged a cycle that survived the rebuild
+    void enumerate(VenueId venue, int at, std::vector<int>& path, std::vector<bool>& visited);
+    double cycleWeight(int cycle) const;
+    void evaluate(int edge, bool& flaggedAny);
+    void flagIfNew(int cycle, double weight, bool& flaggedAny);
+
+    const QuoteFreshness& freshness;
+    double threshold;   // -log(1 + minEdge); a cycle clears below it
+    SymbolTable currencies;
+    int home;
+    double fees[InstrumentRegistry::MAX_VENUES] = {};
+    bool derivatives[InstrumentRegistry::MAX_VENUES] = {}; // !setSpot()
+
+    // (venue * MAX_INSTRUMENTS + instrument) -> its buy edge (the sell edge
+    // follows), NO_MARKET or NOT_A_PAIR
+    std::vector<int> marketEdges;
+
+    // Edges, one entry per column
+    std::vector<Edge> edges;
+    std::vector<double> weights;  // -log(rate after fees), +inf until quoted
+    std::vector<double> prices;
+    std::vector<double> sizes;
+
+    // Cycles as edge lists, and the cycles through each edge (both CSR),
+    // rebuilt lazily after a new pair
+    std::vector<int> cycleOffsets;
+    std::vector<int> cycleEdges;
+    std::vector<int> edgeCycleOffsets;
+    std::vector<int> edgeCycles;
+    bool compiled = false;
+
+    // Cycles flagged since the last opportunities() call, and the weight
+    // each cycle was last handed out at (NaN: not since it last cleared)
+    std::vector<uint8_t> flagged;
+    std::vector<int> pending;
+    std::vector<double> emittedWeight;
+    uint64_t evaluations = 0;
+};
@@ -0,0 +1,43 @@
+#include "arbitrage/DepthLadder.hpp"
+#include <algorithm>
+
+DepthLadder::DepthLadder(const std::vector<std::pair<double, double>>& levels) {
+    prices.reserve(levels.size());
+    cumQty.reserve(levels.size() + 1);
+    cumNotional.reserve(levels.size() + 1);
+    for (const auto& [price, qty] : levels) {
+        if (price <= 0.0 || qty <= 0.0) continue;
+        prices.push_back(price);
+        cumQty.push_back(cumQty.back() + qty);
+        cumNotional.push_back(cumNotional.back() + price * qty);
+    }
+}
+
+double DepthLadder::cost(double qty) const {
+    if (qty <= 0.0) return 0.0;
+    if (qty >= totalQty()) return totalNotional();
+
+    // First level whose cumulative quantity reaches qty; the rest of the
+    // fill sits on it
+    const size_t level = std::lower_bound(cumQty.begin() + 1, cumQty.end(), qty) - cumQty.begin() - 1;
+    return cumNotional[level] + (qty - cumQty[level]) * prices[level];
+}
+
+double DepthLadder::vwap(double qty) const {
+    qty = std::min(qty, totalQty());
+    return qty > 0.0 ? cost(qty) / qty : 0.0;
+}
+
+double DepthLadder::marginalPrice(double qty) const {
+    if (prices.empty()) return 0.0;
+    const size_t level = std::lower_bound(cumQty.begin() + 1, cumQty.end(), qty) - cumQty.begin() - 1;
+    return prices[std::min(level, prices.size() - 1)];
+}
+
+double DepthLadder::qtyFor(double notional) const {
+    if (notional <= 0.0) return 0.0;
+    if (notional >= totalNotional()) return totalQty();
+
+    const size_t level = std::lower_bound(cumNotional.begin() + 1, cumNotional.end(), notional) - cumNotional.begin() - 1;
+    return cumQty[level] + (notional - cumNotional[level]) / prices[level];
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// One side of an L2 book with per-level prefix sums of quantity and
+// notional, so fill queries for any size are a binary search over the
+// levels instead of a walk.
+//
+// Built once per evaluation from a book side (best level first) and then
+// queried as often as needed; levels with a non-positive price or
+// quantity are skipped.
+class DepthLadder {
+public:
+    DepthLadder() = default;
+    explicit DepthLadder(const std::vector<std::pair<double, double>>& levels); // price, quantity
+
+    size_t levels() const { return prices.size(); }
+    double totalQty() const { return cumQty.back(); }
+    double totalNotional() const { return cumNotional.back(); }
+
+    // Notional to fill `qty` walking from the best level; the whole ladder
+    // if qty exceeds it.
+    double cost(double qty) const;
+    // Average fill price for `qty`; 0 on an empty ladder.
+    double vwap(double qty) const;
+    // Price of the level the qty-th unit fills at.
+    double marginalPrice(double qty) const;
+    // Largest quantity whose fill costs at most `notional`.
+    double qtyFor(double notional) const;
+
+    // Cumulative quantity through level i (level i included).
+    double qtyThrough(size_t level) const { return cumQty[level + 1]; }
+    double price(size_t level) const { return prices[level]; }
+
+private:
+    std::vector<double> prices;
+    std::vector<double> cumQty{0.0};      // cumQty[i] = quantity of levels [0, i)
+    std::vector<double> cumNotional{0.0};
+};
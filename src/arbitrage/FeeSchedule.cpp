@@ -0,0 +1,122 @@
+#include "arbitrage/FeeSchedule.hpp"
+#include <iomanip>
+#include <iostream>
+
+namespace {
+    constexpr size_t CELLS = static_cast<size_t>(FeeSchedule::MAX_VENUES) * FeeSchedule::PRODUCTS * FeeSchedule::MAX_TIERS;
+
+    size_t tierIndex(VenueId venue, ProductType product, int tier) {
+        return (static_cast<size_t>(venue) * FeeSchedule::PRODUCTS + static_cast<size_t>(product)) * FeeSchedule::MAX_TIERS + tier;
+    }
+
+    // Published schedules quote percentages
+    FeeRates percent(double maker, double taker, double settlementsPerHour = 0.0) {
+        return {maker / 100.0, taker / 100.0, settlementsPerHour};
+    }
+}
+
+const char* productTypeName(ProductType product) {
+    switch (product) {
+        case ProductType::Spot: return "Spot";
+        case ProductType::Perp: return "Perp";
+        case ProductType::Future: return "Future";
+        case ProductType::Option: return "Option";
+    }
+    return "?";
+}
+
+FeeSchedule::FeeSchedule()
+    : published(CELLS),
+      hasRow(CELLS, 0),
+      byTier(CELLS),
+      active(static_cast<size_t>(MAX_VENUES) * PRODUCTS) {}
+
+void FeeSchedule::setRates(VenueId venue, ProductType product, int tier, const FeeRates& rates) {
+    if (venue < 0 || venue >= MAX_VENUES || tier < 0 || tier >= MAX_TIERS) {
+        std::cerr << "❌ FeeSchedule: no slot for venue " << venue << " tier " << tier << std::endl;
+        return;
+    }
+    published[tierIndex(venue, product, tier)] = rates;
+    hasRow[tierIndex(venue, product, tier)] = 1;
+    resolve();
+}
+
+bool FeeSchedule::setTier(VenueId venue, int tier) {
+    if (venue < 0 || venue >= MAX_VENUES || tier < 0 || tier >= MAX_TIERS) {
+        std::cerr << "❌ FeeSchedule: no VIP tier " << tier << " for venue " << venue << std::endl;
+        return false;
+    }
+    tiers[venue] = tier;
+    resolve();
+    return true;
+}
+
+void FeeSchedule::resolve() {
+    for (VenueId venue = 0; venue < MAX_VENUES; ++venue) {
+        for (int p = 0; p < PRODUCTS; ++p) {
+            const ProductType product = static_cast<ProductType>(p);
+            FeeRates inherited{};
+            for (int tier = 0; tier < MAX_TIERS; ++tier) {
+                const size_t cell = tierIndex(venue, product, tier);
+                if (hasRow[cell]) inherited = published[cell];
+                byTier[cell] = inherited;
+            }
+            active[index(venue, product)] = byTier[tierIndex(venue, product, tiers[venue])];
+        }
+    }
+}
+
+void FeeSchedule::loadDefaults() {
+    constexpr double EVERY_8H = 1.0 / 8.0;
+
+    const VenueId binance = InstrumentRegistry::registerVenue("Binance");
+    setRates(binance, ProductType::Spot, 0, percent(0.100, 0.100));
+    setRates(binance, ProductType::Spot, 1, percent(0.090, 0.100));
+    setRates(binance, ProductType::Spot, 2, percent(0.080, 0.100));
+    setRates(binance, ProductType::Spot, 3, percent(0.042, 0.060));
+    setRates(binance, ProductType::Perp, 0, percent(0.020, 0.050, EVERY_8H));
+    setRates(binance, ProductType::Perp, 1, percent(0.016, 0.040, EVERY_8H));
+    setRates(binance, ProductType::Perp, 2, percent(0.014, 0.035, EVERY_8H));
+    setRates(binance, ProductType::Perp, 3, percent(0.012, 0.032, EVERY_8H));
+    setRates(binance, ProductType::Future, 0, percent(0.020, 0.050));
+    setRates(binance, ProductType::Option, 0, percent(0.030, 0.030));
+
+    const VenueId okx = InstrumentRegistry::registerVenue("OKX");
+    setRates(okx, ProductType::Spot, 0, percent(0.080, 0.100));
+    setRates(okx, ProductType::Spot, 1, percent(0.045, 0.050));
+    setRates(okx, ProductType::Spot, 2, percent(0.040, 0.045));
+    setRates(okx, ProductType::Spot, 3, percent(0.035, 0.040));
+    setRates(okx, ProductType::Perp, 0, percent(0.020, 0.050, EVERY_8H));
+    setRates(okx, ProductType::Perp, 1, percent(0.015, 0.035, EVERY_8H));
+    setRates(okx, ProductType::Perp, 2, percent(0.010, 0.030, EVERY_8H));
+    setRates(okx, ProductType::Perp, 3, percent(0.005, 0.025, EVERY_8H));
+    setRates(okx, ProductType::Future, 0, percent(0.020, 0.050));
+    setRates(okx, ProductType::Option, 0, percent(0.020, 0.030));
+
+    const VenueId bybit = InstrumentRegistry::registerVenue("Bybit");
+    setRates(bybit, ProductType::Spot, 0, percent(0.100, 0.100));
+    setRates(bybit, ProductType::Spot, 1, percent(0.060, 0.080));
+    setRates(bybit, ProductType::Spot, 2, percent(0.050, 0.078));
+    setRates(bybit, ProductType::Spot, 3, percent(0.040, 0.075));
+    setRates(bybit, ProductType::Perp, 0, percent(0.020, 0.055, EVERY_8H));
+    setRates(bybit, ProductType::Perp, 1, percent(0.018, 0.040, EVERY_8H));
+    setRates(bybit, ProductType::Perp, 2, percent(0.016, 0.038, EVERY_8H));
+    setRates(bybit, ProductType::Perp, 3, percent(0.014, 0.035, EVERY_8H));
+    setRates(bybit, ProductType::Future, 0, percent(0.020, 0.055));
+    setRates(bybit, ProductType::Option, 0, percent(0.020, 0.030));
+}
+
+void FeeSchedule::print() const {
+    std::cout << "💸 Fee schedule (maker / taker %)\n";
+    std::cout << std::fixed << std::setprecision(3);
+    for (VenueId venue = 0; venue < InstrumentRegistry::venueCount() && venue < MAX_VENUES; ++venue) {
+        std::cout << "   " << std::left << std::setw(10) << InstrumentRegistry::venueName(venue) << std::right
+                  << " VIP " << tiers[venue];
+        for (int p = 0; p < PRODUCTS; ++p) {
+            const FeeRates& r = rates(venue, static_cast<ProductType>(p));
+            std::cout << "  " << productTypeName(static_cast<ProductType>(p)) << " " << r.maker * 100.0 << " / " << r.taker * 100.0;
+        }
+        std::cout << "\n";
+    }
+    std::cout << std::defaultfloat;
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include "exchange/MarketDataTypes.hpp"
+#include "exchange/InstrumentRegistry.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class ProductType : uint8_t { Spot, Perp, Future, Option };
+
+const char* productTypeName(ProductType product);
+
+// Trading costs of one product on one venue, as fractions of notional.
+struct FeeRates {
+    double maker = 0.0;              // negative = rebate
+    double taker = 0.0;
+    double settlementsPerHour = 0.0; // funding settlements (perps: one per 8h), 0 if none
+};
+
+// Fee and rebate schedules per venue, product type and VIP tier, and the
+// account's tier on each venue.
+//
+// Every (venue, product, tier) cell is resolved when the schedule changes
+// (a tier with no published row inherits the one below it), and so is the
+// account's row per (venue, product). Lookups on the hot path are a single
+// indexed load: no map, no tier search, no branch.
+//
+// Configured at startup, then read-only.
+class FeeSchedule {
+public:
+    static constexpr int MAX_VENUES = InstrumentRegistry::MAX_VENUES;
+    static constexpr int PRODUCTS = 4;
+    static constexpr int MAX_TIERS = 10; // VIP 0-9
+
+    FeeSchedule();
+
+    // Published rates for a tier; higher tiers without their own row inherit them.
+    void setRates(VenueId venue, ProductType product, int tier, const FeeRates& rates);
+    // The account's VIP tier on the venue (default 0). False (with a ❌) if out of range.
+    bool setTier(VenueId venue, int tier);
+    int tier(VenueId venue) const { return tiers[venue]; }
+
+    // The account's rates.
+    const FeeRates& rates(VenueId venue, ProductType product) const { return active[index(venue, product)]; }
+    double taker(VenueId venue, ProductType product) const { return rates(venue, product).taker; }
+
+    // Funding paid (positive) or received over `hours` of holding a long
+    // position at `fundingRate` per settlement, as a fraction of notional.
+    double fundingCost(VenueId venue, ProductType product, double fundingRate, double hours) const {
+        return fundingRate * rates(venue, product).settlementsPerHour * hours;
+    }
+
+    // Binance, OKX and Bybit's published VIP 0-3 schedules (registers the venues).
+    void loadDefaults();
+
+    // The account's maker / taker rates per venue and product.
+    void print() const;
+
+private:
+    static size_t index(VenueId venue, ProductType product) {
+        return static_cast<size_t>(venue) * PRODUCTS + static_cast<size_t>(product);
+    }
+    void resolve();
+
+    std::vector<FeeRates> published; // (venue, product, tier), as set
+    std::vector<uint8_t> hasRow;
+    std::vector<FeeRates> byTier;    // (venue, product, tier), resolved
+    std::vector<FeeRates> active;    // (venue, product) at the account's tier
+    int tiers[MAX_VENUES] = {};
+};
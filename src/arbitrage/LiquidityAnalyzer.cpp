@@ -2,7 +2,7 @@
 #include <algorithm>
 #include<iostream>
 
-double LiquidityAnalyzer::estimateSlippage(const OrderBookUpdate& data, double tradeSizeUSDT) {
+double LiquidityAnalyzer::estimateSlippage(const TopOfBook& data, double tradeSizeUSDT) {
     double mid = (data.bestBid + data.bestAsk) / 2.0;
     double spread = data.bestAsk - data.bestBid;
 
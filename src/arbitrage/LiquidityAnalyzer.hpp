@@ -3,6 +3,6 @@
 
 class LiquidityAnalyzer {
 public:
-    static double estimateSlippage(const OrderBookUpdate& data, double tradeSizeUSDT);
+    static double estimateSlippage(const TopOfBook& data, double tradeSizeUSDT);
     static bool isLiquiditySufficient(const OrderBookUpdate& book, double capital);
 };
@@ -1,16 +1,29 @@
 #pragma once
+#include <algorithm>
 #include <string>
-#include <unordered_map>
-#include <deque>
+#include <span>
 #include <cmath>
 #include <iostream>
+#include "exchange/TickHistory.hpp"
+#include "exchange/HistoryRing.hpp"
 
+// Correlation of mid prices between two tick series (typically the same
+// instrument on two venues), read straight out of the shared TickHistory.
+//
+// Ticks arrive far too often for a window of raw ticks to mean anything
+// (100 bookTicker ticks are well under a second of near-flat mids), so the
+// pair is sampled at a fixed interval instead: each sample() pairs both
+// series' latest mids, an as-of join at the time of the call. The
+// correlation runs over the last WINDOW_SIZE samples.
 class CorrelationAnalyzer {
 private:
-    static inline std::unordered_map<std::string, std::deque<double>> priceHistory;
     static constexpr size_t WINDOW_SIZE = 100;
+    static constexpr size_t MIN_SAMPLES = 30; // fewer and any two paths look (de)correlated
 
-    static double computeCorrelation(const std::deque<double>& x, const std::deque<double>& y) {
+    HistoryRing<double> samplesA{WINDOW_SIZE};
+    HistoryRing<double> samplesB{WINDOW_SIZE};
+
+    static double computeCorrelation(std::span<const double> x, std::span<const double> y) {
         if (x.size() != y.size() || x.size() < 2) return 0.0;
 
         double sumX = 0.0, sumY = 0.0, sumXY = 0.0, sumX2 = 0.0, sumY2 = 0.0;
@@ -32,23 +45,26 @@ private:
     }
 
 public:
-    static void updatePrice(const std::string& symbol, double price) {
-        auto& history = priceHistory[symbol];
-        history.push_back(price);
-        if (history.size() > WINDOW_SIZE) history.pop_front();
+    // Call at a fixed interval (the Venue Correlation periodic: every 2 s).
+    // Skipped until both series have ticked.
+    void sample(const TickSeries& a, const TickSeries& b) {
+        if (a.size() == 0 || b.size() == 0) return;
+        samplesA.push(a.mids(1)[0]);
+        samplesB.push(b.mids(1)[0]);
     }
 
-    static double getCorrelation(const std::string& symbolA, const std::string& symbolB) {
-        const auto& histA = priceHistory[symbolA];
-        const auto& histB = priceHistory[symbolB];
-        return computeCorrelation(histA, histB);
+    size_t samples() const { return std::min(samplesA.size(), WINDOW_SIZE); }
+
+    double getCorrelation() const {
+        return computeCorrelation(samplesA.last(WINDOW_SIZE), samplesB.last(WINDOW_SIZE));
     }
 
-    static void displayAlertIfDiverging(const std::string& symbolA, const std::string& symbolB, double threshold = 0.85) {
-        double corr = getCorrelation(symbolA, symbolB);
+    void displayAlertIfDiverging(const std::string& nameA, const std::string& nameB, double threshold = 0.85) const {
+        if (samples() < MIN_SAMPLES) return;
+        double corr = getCorrelation();
         if (std::abs(corr) >= threshold) return; // acceptable
 
-        std::cout << "⚠️ Correlation Alert: " << symbolA << " & " << symbolB
+        std::cout << "⚠️ Correlation Alert: " << nameA << " & " << nameB
                   << " correlation dropped to " << corr << "\n";
     }
 };
@@ -1,18 +1,20 @@
 #include "arbitrage/StatisticalArbitrageEngine.hpp"
 #include <numeric>
 #include <cmath>
-#include <unordered_map>
 
-std::unordered_map<std::string, std::deque<double>> StatisticalArbitrageEngine::spreadHistoryMap;
+std::vector<HistoryRing<double>> StatisticalArbitrageEngine::spreadHistory;
 
-void StatisticalArbitrageEngine::updateSpreadHistory(const std::string& key, double spread) {
-    auto& history = spreadHistoryMap[key];
-    history.push_back(spread);
-    if (history.size() > MAX_HISTORY) history.pop_front();
+HistoryRing<double>& StatisticalArbitrageEngine::history(int series) {
+    while (series >= static_cast<int>(spreadHistory.size())) spreadHistory.emplace_back(MAX_HISTORY);
+    return spreadHistory[series];
 }
 
-double StatisticalArbitrageEngine::computeZScore(const std::string& key, double currentSpread) {
-    const auto& history = spreadHistoryMap[key];
+void StatisticalArbitrageEngine::updateSpreadHistory(int series, double spread) {
+    history(series).push(spread);
+}
+
+double StatisticalArbitrageEngine::computeZScore(int series, double currentSpread) {
+    const auto history = StatisticalArbitrageEngine::history(series).last(MAX_HISTORY);
     if (history.size() < 20) return 0.0; // Not enough data
 
     double mean = std::accumulate(history.begin(), history.end(), 0.0) / history.size();
@@ -24,8 +26,8 @@ double StatisticalArbitrageEngine::computeZScore(const std::string& key, double
     return stddev == 0.0 ? 0.0 : (currentSpread - mean) / stddev;
 }
 
-bool StatisticalArbitrageEngine::isMeanReversionSignal(const std::string& key, double currentSpread, double thresholdZScore) {
-    updateSpreadHistory(key, currentSpread);
-    double z = computeZScore(key, currentSpread);
+bool StatisticalArbitrageEngine::isMeanReversionSignal(int series, double currentSpread, double thresholdZScore) {
+    updateSpreadHistory(series, currentSpread);
+    double z = computeZScore(series, currentSpread);
     return std::abs(z) >= thresholdZScore;
 }
@@ -1,16 +1,20 @@
 #pragma once
-#include <deque>
+#include "exchange/HistoryRing.hpp"
 #include <string>
 #include<iostream>
-#include <unordered_map>
+#include <vector>
 
+// Spread histories are keyed by InstrumentRegistry series ids; register
+// the key once (InstrumentRegistry::registerSeries) and pass the id.
 class StatisticalArbitrageEngine {
 public:
-    static void updateSpreadHistory(const std::string& key, double spread);
-    static bool isMeanReversionSignal(const std::string& key, double currentSpread, double thresholdZScore);
-    static double computeZScore(const std::string& key, double currentSpread);
+    static void updateSpreadHistory(int series, double spread);
+    static bool isMeanReversionSignal(int series, double currentSpread, double thresholdZScore);
+    static double computeZScore(int series, double currentSpread);
 
 private:
-    static std::unordered_map<std::string, std::deque<double>> spreadHistoryMap;
-    static const size_t MAX_HISTORY = 100;
+    static HistoryRing<double>& history(int series);
+
+    static std::vector<HistoryRing<double>> spreadHistory;
+    static constexpr size_t MAX_HISTORY = 100;
 };
@@ -0,0 +1,484 @@
+#include "arbitrage/StrategyChecks.hpp"
+#include "arbitrage/SyntheticInstrumentCalculator.hpp"
+#include "arbitrage/ArbitrageOpportunity.hpp"
+#include "arbitrage/ArbitrageLegOptimizer.hpp"
+#include "arbitrage/RiskManager.hpp"
+#include "arbitrage/TradeExecutor.hpp"
+#include "arbitrage/VolatilityArbitrage.hpp"
+#include "arbitrage/StatisticalArbitrageEngine.hpp"
+#include "monitoring/RiskDashboard.hpp"
+#include "monitoring/StressTester.hpp"
+#include "arbitrage/Risk/CorrelationAnalyzer.hpp"
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+
+const std::vector<std::string> WATCHED_ASSETS = {"BTC", "ETH", "SOL", "XRP", "BNB", "DOGE"};
+const std::vector<std::string> WATCHED_CROSSES = {"ETH/BTC", "SOL/BTC", "XRP/BTC"};
+
+std::vector<std::string> venueSymbols(const std::string& separator, bool lowercase, bool spot)
+{
+    std::vector<std::string> symbols;
+    for (const auto &asset : WATCHED_ASSETS)
+    {
+        std::string symbol = asset + separator + "USDT";
+        if (lowercase)
+            std::transform(symbol.begin(), symbol.end(), symbol.begin(), ::tolower);
+        symbols.push_back(symbol);
+    }
+    if (!spot)
+        return symbols;
+    for (auto symbol : WATCHED_CROSSES)
+    {
+        symbol.replace(symbol.find('/'), 1, separator);
+        if (lowercase)
+            std::transform(symbol.begin(), symbol.end(), symbol.begin(), ::tolower);
+        symbols.push_back(symbol);
+    }
+    return symbols;
+}
+
+InstrumentId primaryInstrument()
+{
+    static const InstrumentId id = InstrumentRegistry::registerInstrument("BTC/USDT");
+    return id;
+}
+
+namespace
+{
+    // Registry ids the checks read, resolved once instead of per evaluation
+    struct CheckIds
+    {
+        VenueId binance = InstrumentRegistry::registerVenue("Binance");
+        VenueId okx = InstrumentRegistry::registerVenue("OKX");
+        VenueId bybit = InstrumentRegistry::registerVenue("Bybit");
+        InstrumentId btc = primaryInstrument();
+        int spotSynthSpread = InstrumentRegistry::registerSeries("BTC_SPOT_SYNTH");
+    };
+
+    const CheckIds &ids()
+    {
+        static const CheckIds instance;
+        return instance;
+    }
+
+    // What each client's book actually trades, for its fees: Binance
+    // (bookTicker on stream.binance.com) and OKX stream spot, Bybit
+    // (/v5/public/linear) streams USDT perps
+    ProductType quotedProduct(VenueId venue)
+    {
+        return venue == ids().bybit ? ProductType::Perp : ProductType::Spot;
+    }
+
+    // BTC/USDT synthetics the checks read, set by defineSynthetics()
+    struct SyntheticIds
+    {
+        SyntheticId spot = -1;
+        SyntheticId future = -1;
+    } btcSynthetics;
+
+    // Book for executable pricing and the depth-walking risk checks: the
+    // aggregator's full view when depth is enabled, otherwise the levels
+    // carried in the top of book.
+    OrderBookUpdate bookFor(const MarketDataAggregator &aggregator, VenueId venue, const TopOfBook &top)
+    {
+        OrderBookUpdate book{};
+        if (aggregator.getBook(venue, top.instrument, book))
+            return book;
+
+        book.instrument = top.instrument;
+        book.bestBid = top.bestBid;
+        book.bestAsk = top.bestAsk;
+        book.bestBidQty = top.bestBidQty;
+        book.bestAskQty = top.bestAskQty;
+        for (size_t i = 0; i < top.bidDepth; ++i)
+            book.bids.emplace_back(top.bid(i).price, top.bid(i).qty);
+        for (size_t i = 0; i < top.askDepth; ++i)
+            book.asks.emplace_back(top.ask(i).price, top.ask(i).qty);
+        return book;
+    }
+
+    // Keeps a check that runs on every tick of its venues from printing and
+    // trading on every tick: a full pass at most every PASS_INTERVAL, or at
+    // once when one of its opportunities appears, and each opportunity
+    // executed once until it stops clearing.
+    class TickGate
+    {
+    public:
+        static constexpr std::chrono::seconds PASS_INTERVAL{2};
+
+        // `clearing` has one bit per opportunity the check can take, set while it clears
+        bool pass(uint32_t clearing, MonoTimestamp now)
+        {
+            const uint32_t appeared = clearing & ~open;
+            open = clearing;
+            executed &= clearing;
+            if (!appeared && lastPass != MonoTimestamp{} && now - lastPass < PASS_INTERVAL)
+                return false;
+            lastPass = now;
+            return true;
+        }
+
+        // True once per appearance of the opportunity
+        bool execute(uint32_t bit)
+        {
+            if (executed & bit)
+                return false;
+            executed |= bit;
+            return true;
+        }
+
+    private:
+        uint32_t open = 0;
+        uint32_t executed = 0;
+        MonoTimestamp lastPass{};
+    };
+
+    TickGate syntheticFuturesGate;
+    TickGate syntheticVsRealGate;
+
+    // Opportunity bits for a real vs synthetic price pair (as evaluateArbitrage
+    // trades it): 1 if buying real and selling synthetic clears `minPercent`
+    // after fees, 2 for the other way round, shifted by 2 * slot
+    uint32_t clearingBits(double real, double synthetic, double feePercent, double minPercent, int slot)
+    {
+        if (SyntheticInstrumentCalculator::netEdgePercent(real, synthetic, feePercent) < minPercent)
+            return 0;
+        return (synthetic > real ? 1u : 2u) << (2 * slot);
+    }
+}
+
+void defineSynthetics(SyntheticGraph &graph, const FeeSchedule &fees)
+{
+    // Same models as SyntheticInstrumentCalculator's synthetic spot and
+    // funding-model future, kept up to date leg by leg instead of per check
+    auto spotFunding = graph.param("synthetic spot funding", 2.0);
+    auto spotLeverage = graph.param("synthetic spot leverage", 0.0005);
+    auto futureSettlements = graph.param("synthetic future settlements",
+                                         fees.rates(ids().binance, ProductType::Perp).settlementsPerHour * SYNTHETIC_FUTURE_HOURS);
+
+    for (const auto &asset : WATCHED_ASSETS)
+    {
+        const std::string symbol = asset + "/USDT";
+        const InstrumentId instrument = InstrumentRegistry::registerInstrument(symbol);
+
+        const SyntheticId spot = graph.define(symbol + " Synthetic Spot (Binance perp)", instrument,
+                                              graph.mid(ids().binance, instrument) * (1.0 + spotFunding * spotLeverage));
+        const SyntheticId future = graph.define(symbol + " Synthetic Future (OKX + funding)", instrument,
+                                                graph.mid(ids().okx, instrument) * (1.0 + graph.funding(ids().binance, instrument) * futureSettlements));
+        if (instrument == ids().btc)
+            btcSynthetics = {spot, future};
+    }
+}
+
+double syntheticFutureFeePercent(const FeeSchedule &fees, double fundingRate, bool futureAboveSpot)
+{
+    const double okxTaker = fees.taker(ids().okx, quotedProduct(ids().okx));
+    // Same units as the synthetic's premium (defineSynthetics), so a future
+    // priced only off funding nets out to the fees
+    const double carry = fees.fundingCost(ids().binance, ProductType::Perp, fundingRate, SYNTHETIC_FUTURE_HOURS);
+    return (2.0 * okxTaker + (futureAboveSpot ? carry : -carry)) * 100.0;
+}
+
+void applyFees(const FeeSchedule &fees, CrossVenueScanner &scanner, CurrencyCycleDetector &cycles)
+{
+    // Each venue's pairs trade on whatever its client streams
+    for (VenueId venue = 0; venue < InstrumentRegistry::venueCount() && venue < FeeSchedule::MAX_VENUES; ++venue)
+    {
+        scanner.setFee(venue, fees.taker(venue, quotedProduct(venue)));
+        cycles.setFee(venue, fees.taker(venue, quotedProduct(venue)));
+        cycles.setSpot(venue, quotedProduct(venue) == ProductType::Spot);
+    }
+}
+
+void checkSyntheticFutures(MarketDataAggregator &aggregator, const QuoteFreshness &freshness, const SyntheticGraph &synthetics, const FeeSchedule &fees)
+{
+    if (!freshness.areFresh(ids().btc, QuoteFreshness::bit(ids().binance) | QuoteFreshness::bit(ids().okx)))
+        return;
+    TopOfBook binanceSpot, okxSpot;
+    if (!aggregator.getLatest(ids().binance, ids().btc, binanceSpot) || !aggregator.getLatest(ids().okx, ids().btc, okxSpot))
+        return;
+
+    double realSpot = (okxSpot.bestBid + okxSpot.bestAsk) / 2.0;
+    const double syntheticSpot = synthetics.value(btcSynthetics.spot);
+    const double syntheticFuture = synthetics.value(btcSynthetics.future);
+
+    auto fundingDataOpt = aggregator.getFundingData(ids().binance, ids().btc);
+    if (!fundingDataOpt || std::isnan(syntheticSpot) || std::isnan(syntheticFuture))
+        return;
+
+    double fundingRate = fundingDataOpt->fundingRate;
+
+    // The spot trade crosses OKX's book against Binance's; the future trade
+    // has both legs on OKX
+    const double feePercent = (fees.taker(ids().okx, quotedProduct(ids().okx)) + fees.taker(ids().binance, quotedProduct(ids().binance))) * 100.0;
+    const double futureFeePercent = syntheticFutureFeePercent(fees, fundingRate, syntheticFuture > realSpot);
+    const uint32_t clearing = clearingBits(realSpot, syntheticSpot, feePercent, MIN_NET_EDGE_BPS / 100.0, 0) |
+                              clearingBits(realSpot, syntheticFuture, futureFeePercent, MIN_NET_EDGE_BPS / 100.0, 1);
+    if (!syntheticFuturesGate.pass(clearing, freshness.now()))
+        return;
+
+    std::cout << "\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+    std::cout << "🔍 SYNTHETIC FUTURES ANALYSIS\n";
+    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+
+    double mispricing1 = SyntheticInstrumentCalculator::computeMispricing(realSpot, syntheticSpot);
+    double mispricing2 = SyntheticInstrumentCalculator::computeMispricing(realSpot, syntheticFuture);
+
+    std::cout << "📊 Real Spot (OKX): " << realSpot << "\n";
+    std::cout << "🧮 Synthetic Spot (Binance): " << syntheticSpot << " → Mispricing: " << mispricing1 << "%\n";
+    std::cout << "🧮 Synthetic Future (Funding Model): " << syntheticFuture << " → Mispricing: " << mispricing2 << "%\n";
+    std::cout << "💸 Fees: " << feePercent << "% | Synthetic future incl. 7-day funding carry: " << futureFeePercent << "%\n";
+
+    RiskDashboard::displayFundingImpact("BTC/USDT", fundingRate, 10000.0);
+    RiskDashboard::displayLiquidityAlert("BTC/USDT", okxSpot, 2.0);
+    RiskDashboard::displayBasisRisk("BTC/USDT", realSpot, syntheticFuture);
+
+    double spread = syntheticSpot - realSpot;
+    StatisticalArbitrageEngine::updateSpreadHistory(ids().spotSynthSpread, spread);
+    if (StatisticalArbitrageEngine::isMeanReversionSignal(ids().spotSynthSpread, spread, 2.0))
+    {
+        std::cout << "📈 Stat-Arb Signal: Spread deviation detected (Z-Score ≥ 2)\n";
+    }
+
+    double capital1 = ArbitrageLegOptimizer::computeCapitalLimit(okxSpot, binanceSpot, 10000.0);
+    double capital2 = ArbitrageLegOptimizer::computeCapitalLimit(okxSpot, okxSpot, 10000.0);
+
+    ArbitrageOpportunity arb1 = SyntheticInstrumentCalculator::evaluateArbitrage("BTC/USDT", "OKX", "Binance", realSpot, syntheticSpot, MIN_NET_EDGE_BPS / 100.0, capital1, okxSpot, binanceSpot, feePercent);
+    ArbitrageOpportunity arb2 = SyntheticInstrumentCalculator::evaluateArbitrage("BTC/USDT", "OKX", "OKX", realSpot, syntheticFuture, MIN_NET_EDGE_BPS / 100.0, capital2, okxSpot, binanceSpot, futureFeePercent);
+
+    if (!arb1.longExchange.empty() && RiskManager::isRiskAcceptable(arb1, bookFor(aggregator, ids().okx, okxSpot)) &&
+        syntheticFuturesGate.execute(clearing & 0b0011)) {
+        arb1.strategyType = "Spot vs Synthetic Spot";
+        std::cout << arb1.describe();
+        TradeExecutor::executeTrade(arb1);
+    }
+
+    if (!arb2.longExchange.empty() && RiskManager::isRiskAcceptable(arb2, bookFor(aggregator, ids().okx, okxSpot)) &&
+        syntheticFuturesGate.execute(clearing & 0b1100)) {
+        arb2.strategyType = "Spot vs Synthetic Future";
+        std::cout << arb2.describe();
+        TradeExecutor::executeTrade(arb2);
+    }
+
+    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+}
+
+void trackVenueCorrelation(const TickHistory &history)
+{
+    const TickSeries *binance = history.series(ids().binance, ids().btc);
+    const TickSeries *bybit = history.series(ids().bybit, ids().btc);
+    if (!binance || !bybit)
+        return;
+
+    static CorrelationAnalyzer binanceBybit;
+    binanceBybit.sample(*binance, *bybit);
+    binanceBybit.displayAlertIfDiverging("Binance BTC/USDT", "Bybit BTC/USDT");
+}
+
+void checkCrossExchangeSpotArb(MarketDataAggregator &aggregator, const ConsolidatedBook &consolidated, CrossVenueScanner &scanner)
+{
+    // Candidates come out grouped by instrument; only the best of each is traded
+    const auto candidates = scanner.scan();
+    for (size_t i = 0; i < candidates.size();)
+    {
+        const ArbCandidate *best = &candidates[i];
+        for (++i; i < candidates.size() && candidates[i].instrument == best->instrument; ++i)
+            if (candidates[i].netEdgeBps > best->netEdgeBps)
+                best = &candidates[i];
+
+        // A cross that persists is traded once, until its venues or prices move
+        if (!scanner.claim(*best))
+            continue;
+
+        TopOfBook buyBook, sellBook;
+        if (!aggregator.getLatest(best->buyVenue, best->instrument, buyBook) || !aggregator.getLatest(best->sellVenue, best->instrument, sellBook))
+            continue;
+
+        const std::string &symbol = InstrumentRegistry::instrumentName(best->instrument);
+        const std::string &buyVenue = InstrumentRegistry::venueName(best->buyVenue);
+        const std::string &sellVenue = InstrumentRegistry::venueName(best->sellVenue);
+
+        std::cout << "\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+        std::cout << "🔍 CROSS-EXCHANGE SPOT ARBITRAGE\n";
+        std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+
+        std::cout << "≡ " << symbol << ": buy " << buyVenue << " @ " << best->buyPrice << ", sell " << sellVenue << " @ "
+                  << best->sellPrice << " (" << best->netEdgeBps << " bps after fees)\n";
+        const auto &bids = consolidated.bids(best->instrument);
+        const auto &asks = consolidated.asks(best->instrument);
+        for (int level = 0; level < std::max(bids.size(), asks.size()) && level < 3; ++level)
+        {
+            std::cout << "   ";
+            if (level < bids.size())
+                std::cout << InstrumentRegistry::venueName(bids[level].venue) << " " << bids[level].qty << " @ " << bids[level].price;
+            std::cout << "  |  ";
+            if (level < asks.size())
+                std::cout << asks[level].price << " x " << asks[level].qty << " " << InstrumentRegistry::venueName(asks[level].venue);
+            std::cout << "\n";
+        }
+
+        // Priced and sized against the books behind the quotes, not just the best levels
+        const OrderBookUpdate buyDepth = bookFor(aggregator, best->buyVenue, buyBook);
+        const OrderBookUpdate sellDepth = bookFor(aggregator, best->sellVenue, sellBook);
+        ArbitrageOpportunity arb = SyntheticInstrumentCalculator::evaluateExecutableArbitrage(
+            symbol, buyVenue, sellVenue, DepthLadder(buyDepth.asks), DepthLadder(sellDepth.bids),
+            scanner.takerFee(best->buyVenue, best->instrument), scanner.takerFee(best->sellVenue, best->instrument),
+            MIN_NET_EDGE_BPS / 100.0, 10000.0, buyBook, sellBook);
+
+        if (!arb.longExchange.empty() && RiskManager::isRiskAcceptable(arb, buyDepth)) {
+            arb.strategyType = "Cross-Exchange Spot Arbitrage";
+            std::cout << arb.describe();
+            TradeExecutor::executeTrade(arb);
+        }
+
+        std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+    }
+}
+
+
+void checkCurrencyCycles(CurrencyCycleDetector &cycles)
+{
+    for (const MultiLegOpportunity &opp : cycles.opportunities(10000.0))
+    {
+        std::cout << "\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+        std::cout << "🔍 CURRENCY CYCLE ARBITRAGE\n";
+        std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+        std::cout << opp.describe();
+        TradeExecutor::executeMultiLeg(opp);
+        std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+    }
+}
+
+void checkSyntheticVsRealSpot(MarketDataAggregator &aggregator, const QuoteFreshness &freshness, const SyntheticGraph &synthetics, const FeeSchedule &fees)
+{
+    if (!freshness.areFresh(ids().btc, QuoteFreshness::bit(ids().binance) | QuoteFreshness::bit(ids().bybit)))
+        return;
+    TopOfBook binanceSpot, bybitPerp;
+    if (!aggregator.getLatest(ids().binance, ids().btc, binanceSpot) || !aggregator.getLatest(ids().bybit, ids().btc, bybitPerp))
+        return;
+
+    const double binanceSynthetic = synthetics.value(btcSynthetics.spot);
+    if (std::isnan(binanceSynthetic))
+        return;
+    double realBybit = (bybitPerp.bestBid + bybitPerp.bestAsk) / 2.0;
+
+    const double feePercent = (fees.taker(ids().bybit, quotedProduct(ids().bybit)) + fees.taker(ids().binance, quotedProduct(ids().binance))) * 100.0;
+    const uint32_t clearing = clearingBits(realBybit, binanceSynthetic, feePercent, MIN_NET_EDGE_BPS / 100.0, 0);
+    if (!syntheticVsRealGate.pass(clearing, freshness.now()))
+        return;
+
+    std::cout << "\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+    std::cout << "🔍 SYNTHETIC VS REAL SPOT (BINANCE vs BYBIT)\n";
+    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+
+    RiskDashboard::displayLiquidityAlert("BTC/USDT", bybitPerp, 2.0);
+    RiskDashboard::displayLiquidityAlert("BTC/USDT", binanceSpot, 2.0);
+
+    double mispricing = SyntheticInstrumentCalculator::computeMispricing(realBybit, binanceSynthetic);
+    std::cout << "≡ Mispricing (Synthetic Spot vs Real Spot): " << mispricing << "%\n";
+
+    double capital = ArbitrageLegOptimizer::computeCapitalLimit(bybitPerp, binanceSpot, 10000.0);
+    ArbitrageOpportunity arb = SyntheticInstrumentCalculator::evaluateArbitrage("BTC/USDT", "Bybit", "Binance", realBybit, binanceSynthetic, MIN_NET_EDGE_BPS / 100.0, capital, bybitPerp, binanceSpot, feePercent);
+
+    if (!arb.longExchange.empty() && RiskManager::isRiskAcceptable(arb, bookFor(aggregator, ids().bybit, bybitPerp)) &&
+        syntheticVsRealGate.execute(clearing)) {
+        arb.strategyType = "Synthetic Spot vs Real Spot";
+        std::cout << arb.describe();
+        TradeExecutor::executeTrade(arb);
+    }
+
+    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+}
+
+void runStressTest(MarketDataAggregator &aggregator)
+{
+    TopOfBook binance;
+    if (!aggregator.getLatest(ids().binance, ids().btc, binance))
+        return;
+
+    std::cout << "\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+    std::cout << "🧪 STRESS TEST - PRICE SHOCK SIMULATION\n";
+    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+    TopOfBook shockedBook = StressTester::simulatePriceShock(binance, -20.0);
+
+    std::cout << "⚠️ Simulated -20% Price Shock on Binance\n";
+    std::cout << "Old Bid: " << binance.bestBid << " | New Bid: " << shockedBook.bestBid << "\n";
+
+    SyntheticInstrument synthetic = SyntheticInstrumentCalculator::computeSyntheticSpot(shockedBook, 0.0005, 2.0);
+    std::cout << "📉 Synthetic Spot Price After Shock: " << synthetic.price << "\n";
+
+    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+}
+
+void registerStrategies(StrategyDispatcher &dispatcher, const MarketViews &market)
+{
+    ids();
+    primaryInstrument();
+
+    dispatcher.addStrategy("Synthetic Futures",
+                           {MarketDataAggregator::keyFor("Binance"), MarketDataAggregator::keyFor("OKX"),
+                            MarketDataAggregator::keyFor("Binance:funding")},
+                           [market] { checkSyntheticFutures(market.aggregator, market.freshness, market.synthetics, market.fees); });
+    // Sampled on a timer: a window of raw ticks spans well under a second
+    dispatcher.addPeriodic("Venue Correlation", std::chrono::seconds(2),
+                           [market] { trackVenueCorrelation(market.history); });
+    dispatcher.addStrategy("Cross-Exchange Spot", {ConsolidatedBook::CROSS_KEY, CrossVenueScanner::SCAN_KEY},
+                           [market] { checkCrossExchangeSpotArb(market.aggregator, market.consolidated, market.scanner); });
+    dispatcher.addStrategy("Currency Cycles", {CurrencyCycleDetector::CYCLE_KEY},
+                           [market] { checkCurrencyCycles(market.cycles); });
+    dispatcher.addStrategy("Synthetic vs Real Spot", {MarketDataAggregator::keyFor("Binance"), MarketDataAggregator::keyFor("Bybit")},
+                           [market] { checkSyntheticVsRealSpot(market.aggregator, market.freshness, market.synthetics, market.fees); });
+    dispatcher.addStrategy("Volatility Arbitrage", {MarketDataAggregator::keyFor("OKX")},
+                           [market] { VolatilityArbitrage::checkVolatilityArbitrage(market.aggregator); });
+}
+
+void connectStrategies(StrategyDispatcher &dispatcher, const MarketState &state)
+{
+    registerStrategies(dispatcher, state.views());
+
+    state.aggregator.setUpdateListener([&dispatcher, primary = primaryInstrument()](int key, InstrumentId instrument, MonoTimestamp receivedAt) {
+        if (instrument == primary)
+            dispatcher.notify(key, receivedAt);
+    });
+    state.consolidated.setCrossListener([&dispatcher](const ConsolidatedBook::CrossEvent &event) {
+        dispatcher.notify(ConsolidatedBook::CROSS_KEY, event.receivedAt);
+    });
+
+    // A stalled venue's last quotes must not set the consolidated best bid/offer
+    state.freshness.setStallListener([&consolidated = state.consolidated](VenueId venue, bool stalled) {
+        if (stalled)
+            consolidated.removeVenue(venue);
+    });
+    dispatcher.addPeriodic("Stall Detector", std::chrono::milliseconds(500), [&freshness = state.freshness]() {
+        freshness.checkStalls();
+    });
+}
+
+void applyMarketUpdate(const MarketState &state, StrategyDispatcher &dispatcher, const TopOfBook &top)
+{
+    if (top.withdrawn())
+    {
+        // The feed is resyncing this book: no check may compare against the
+        // venue's last quote until the snapshot is back. The empty quote
+        // takes the venue out of the consolidated book and the scanner.
+        state.freshness.remove(top.venue, top.instrument);
+        state.aggregator.update(top);
+        state.consolidated.update(top);
+        state.scanner.update(top);
+        return;
+    }
+
+    state.freshness.update(top);
+    state.aggregator.update(top);
+    state.consolidated.update(top);
+    auto funding = state.aggregator.getFundingData(top.venue, top.instrument);
+    state.history.record(top, funding ? funding->fundingRate : 0.0);
+    state.synthetics.update(top, funding ? funding->fundingRate : 0.0);
+    if (state.scanner.update(top)) // any instrument, unlike the aggregator keys
+        dispatcher.notify(CrossVenueScanner::SCAN_KEY, top.receiveTime);
+    if (state.cycles.update(top))
+        dispatcher.notify(CurrencyCycleDetector::CYCLE_KEY, top.receiveTime);
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include "exchange/MarketDataAggregator.hpp"
+#include "exchange/ConsolidatedBook.hpp"
+#include "exchange/TickHistory.hpp"
+#include "exchange/QuoteFreshness.hpp"
+#include "arbitrage/SyntheticGraph.hpp"
+#include "arbitrage/CrossVenueScanner.hpp"
+#include "arbitrage/CurrencyCycleDetector.hpp"
+#include "arbitrage/FeeSchedule.hpp"
+#include "arbitrage/StrategyDispatcher.hpp"
+#include "exchange/InstrumentRegistry.hpp"
+#include <string>
+#include <vector>
+
+// Base assets watched against USDT on every venue. All of them land in
+// the aggregator; the strategies below still only trade BTC/USDT.
+extern const std::vector<std::string> WATCHED_ASSETS;
+// Cross pairs watched on the spot venues, so the currency cycle detector
+// has triangles to close (USDT -> BTC -> ETH -> USDT).
+extern const std::vector<std::string> WATCHED_CROSSES;
+
+// Edge an opportunity must keep after every fee to be traded.
+constexpr double MIN_NET_EDGE_BPS = 2.0;
+
+// Window the synthetic future carries the Binance perp's funding over.
+constexpr double SYNTHETIC_FUTURE_HOURS = 7.0 * 24.0;
+
+// Venue-specific spellings of WATCHED_ASSETS against USDT, then (spot
+// feeds only: there are no USDT-margined ETH/BTC contracts) of
+// WATCHED_CROSSES, e.g. ("-", false, true) -> "BTC-USDT", ..., "ETH-BTC".
+std::vector<std::string> venueSymbols(const std::string& separator, bool lowercase, bool spot);
+// BTC/USDT, the instrument the aggregator and the checks below trade.
+// Registers it on first call, so call it once at startup.
+InstrumentId primaryInstrument();
+
+// The market state the checks read. Owned by main.cpp (or feed_replay) and
+// updated on the dispatcher thread, except the aggregator (see its notes).
+struct MarketViews
+{
+    MarketDataAggregator &aggregator;
+    const ConsolidatedBook &consolidated;
+    const TickHistory &history;
+    const QuoteFreshness &freshness;
+    const SyntheticGraph &synthetics;
+    CrossVenueScanner &scanner;
+    CurrencyCycleDetector &cycles;
+    const FeeSchedule &fees;
+};
+
+// The same state, writable: what the "Market State" bus consumer updates.
+struct MarketState
+{
+    MarketDataAggregator &aggregator;
+    ConsolidatedBook &consolidated;
+    TickHistory &history;
+    QuoteFreshness &freshness;
+    SyntheticGraph &synthetics;
+    CrossVenueScanner &scanner;
+    CurrencyCycleDetector &cycles;
+    const FeeSchedule &fees;
+
+    MarketViews views() const { return {aggregator, consolidated, history, freshness, synthetics, scanner, cycles, fees}; }
+};
+
+// Defines the synthetics the checks price against, for every watched asset:
+// a synthetic spot from the Binance perp and a 7-day synthetic future from
+// OKX spot plus Binance funding. Funding is a rate per settlement, as the
+// mark price stream sends it, compounded over the perp's settlements in
+// SYNTHETIC_FUTURE_HOURS per `fees`. Call once fees are loaded, before
+// registerStrategies().
+void defineSynthetics(SyntheticGraph &graph, const FeeSchedule &fees);
+
+// Round-trip cost, in percent, of the Spot vs Synthetic Future trade: both
+// legs trade OKX's book, and the synthetic future's premium over spot is
+// the funding its perp pays over the window, a carry rather than an edge.
+double syntheticFutureFeePercent(const FeeSchedule &fees, double fundingRate, bool futureAboveSpot);
+
+// Loads the account's taker fees into the scanner and the cycle detector,
+// for the product each venue's client streams (Bybit: linear perps, the
+// others: spot), and keeps non-spot venues out of the cycle graph. Call
+// once venues and VIP tiers are set, before feeds start.
+void applyFees(const FeeSchedule &fees, CrossVenueScanner &scanner, CurrencyCycleDetector &cycles);
+
+// Detection functions shared by the live engine (main.cpp) and the feed
+// replay tool. They read the aggregator's latest BTC/USDT quotes and print,
+// score and execute whatever they find. Checks that compare venues skip
+// the pass unless every quote involved is within its staleness limit.
+// The synthetic checks run on every tick of their venues, so they print a
+// full pass at most every 2 s (or as soon as an opportunity appears) and
+// trade each opportunity once while it keeps clearing.
+void checkSyntheticFutures(MarketDataAggregator &aggregator, const QuoteFreshness &freshness, const SyntheticGraph &synthetics, const FeeSchedule &fees);
+// Samples Binance and Bybit BTC/USDT mids and alerts when they stop moving
+// together. Call at a fixed interval (registerStrategies: every 2 s).
+void trackVenueCorrelation(const TickHistory &history);
+// Scans every instrument on every venue pair and trades, per instrument,
+// the pair with the best edge after taker fees, if it still clears
+// MIN_NET_EDGE_BPS at the VWAPs of the size that maximizes the net profit.
+void checkCrossExchangeSpotArb(MarketDataAggregator &aggregator, const ConsolidatedBook &consolidated, CrossVenueScanner &scanner);
+// Trades every conversion cycle the detector flagged that still clears.
+void checkCurrencyCycles(CurrencyCycleDetector &cycles);
+void checkSyntheticVsRealSpot(MarketDataAggregator &aggregator, const QuoteFreshness &freshness, const SyntheticGraph &synthetics, const FeeSchedule &fees);
+void runStressTest(MarketDataAggregator &aggregator);
+
+// Registers the checks above with the aggregator keys each one reads, so
+// an update only re-runs the strategies it can affect. Also registers the
+// venues and series the checks use, so call it before feeds start.
+void registerStrategies(StrategyDispatcher &dispatcher, const MarketViews &market);
+
+// registerStrategies() plus the listeners that raise its keys (BTC/USDT
+// aggregator updates, consolidated crosses), the stall detector and the
+// stall listener that takes a quiet venue out of the consolidated BBO.
+// The wiring main.cpp and feed_replay share.
+void connectStrategies(StrategyDispatcher &dispatcher, const MarketState &state);
+
+// The "Market State" consumer: applies one bus update to every view, in
+// the order the checks depend on, and raises the scanner and cycle keys.
+// A withdrawn update (a feed resyncing that book) instead makes the venue's
+// quote stale and takes it out of the aggregator, the consolidated book
+// and the scanner. Runs on the dispatcher thread.
+void applyMarketUpdate(const MarketState &state, StrategyDispatcher &dispatcher, const TopOfBook &top);
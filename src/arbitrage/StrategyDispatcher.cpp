@@ -0,0 +1,154 @@
+#include "arbitrage/StrategyDispatcher.hpp"
+#include "monitoring/PerformanceMonitor.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+    int64_t monoNs(MonoTimestamp t) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+    }
+}
+
+void StrategyDispatcher::addStrategy(const std::string& name, const std::vector<int>& triggers, Task task) {
+    auto strategy = std::make_unique<Strategy>();
+    strategy->name = name;
+    strategy->task = std::move(task);
+    for (int key : triggers) {
+        if (key < 0) continue;
+        if (key >= static_cast<int>(byTrigger.size())) byTrigger.resize(key + 1);
+        byTrigger[key].push_back(strategy.get());
+    }
+    strategies.push_back(std::move(strategy));
+}
+
+void StrategyDispatcher::addPeriodic(const std::string& name, std::chrono::milliseconds interval, Task task) {
+    periodics.push_back({name, interval, std::move(task)});
+}
+
+void StrategyDispatcher::addSource(Source source) {
+    sources.push_back(std::move(source));
+}
+
+void StrategyDispatcher::notify(int key, MonoTimestamp receivedAt) {
+    if (key < 0 || key >= static_cast<int>(byTrigger.size()) || byTrigger[key].empty()) return;
+
+    if (receivedAt == MonoTimestamp{}) receivedAt = std::chrono::steady_clock::now();
+    const int64_t since = std::max<int64_t>(monoNs(receivedAt), 1);
+
+    bool newlyPending = false;
+    for (Strategy* strategy : byTrigger[key]) {
+        int64_t expected = 0;
+        if (strategy->pendingSinceNs.compare_exchange_strong(expected, since, std::memory_order_acq_rel)) {
+            newlyPending = true;
+        } else {
+            strategy->coalesced.fetch_add(1, std::memory_order_relaxed); // rides on the pending evaluation
+        }
+    }
+
+    // Only the first update of a burst pays for the wakeup
+    if (newlyPending) wake();
+}
+
+void StrategyDispatcher::wake() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        signaled = true;
+    }
+    wakeCv.notify_one();
+}
+
+bool StrategyDispatcher::pollSources() {
+    bool more = false;
+    for (auto& source : sources) more |= source();
+    return more;
+}
+
+// One pass over pending strategies; each sees the latest state at the time it runs.
+bool StrategyDispatcher::runPending(MonoTimestamp now) {
+    bool ranAny = false;
+
+    for (auto& strategy : strategies) {
+        int64_t since = strategy->pendingSinceNs.exchange(0, std::memory_order_acq_rel);
+        if (since == 0) continue;
+
+        if (!ranAny) PerformanceMonitor::startLatencyTimer();
+        ranAny = true;
+
+        strategy->wait.record(monoNs(now) - since);
+        ++strategy->evaluations;
+
+        try {
+            strategy->task();
+        } catch (const std::exception& e) {
+            std::cerr << "❌ Strategy " << strategy->name << " failed: " << e.what() << std::endl;
+        }
+    }
+
+    if (ranAny) {
+        PerformanceMonitor::recordUpdate();
+        PerformanceMonitor::stopLatencyTimer();
+    }
+    return ranAny;
+}
+
+MonoTimestamp StrategyDispatcher::runDuePeriodics(MonoTimestamp now) {
+    auto next = now + std::chrono::seconds(1);
+
+    for (auto& periodic : periodics) {
+        if (periodic.due == MonoTimestamp{}) {
+            periodic.due = now + periodic.interval;
+        } else if (periodic.due <= now) {
+            periodic.task();
+            periodic.due = now + periodic.interval;
+        }
+        next = std::min(next, periodic.due);
+    }
+    return next;
+}
+
+void StrategyDispatcher::run() {
+    while (running.load()) {
+        bool more = pollSources();
+        runPending(std::chrono::steady_clock::now());
+        auto nextPeriodic = runDuePeriodics(std::chrono::steady_clock::now());
+        if (more) continue;
+
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        wakeCv.wait_until(lock, nextPeriodic, [this] { return signaled || !running.load(); });
+        signaled = false;
+    }
+}
+
+void StrategyDispatcher::step(MonoTimestamp now) {
+    // Same order as run(): strategies between source batches, periodics last
+    bool more = true;
+    while (more) {
+        more = pollSources();
+        runPending(now);
+    }
+    runDuePeriodics(now);
+}
+
+void StrategyDispatcher::stop() {
+    running.store(false);
+    wake();
+}
+
+void StrategyDispatcher::printStats() {
+    std::cout << "⚡ Strategy Dispatch (wait µs)" << std::string(10, ' ')
+              << "     p50       p99       max     evals  coalesced\n";
+
+    for (auto& strategy : strategies) {
+        auto& wait = strategy->wait;
+        std::cout << "   ➤ " << std::left << std::setw(26) << strategy->name << std::right
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(10) << wait.percentileNanos(50) / 1000.0
+                  << std::setw(10) << wait.percentileNanos(99) / 1000.0
+                  << std::setw(10) << wait.maxNanos() / 1000.0
+                  << std::setw(10) << strategy->evaluations
+                  << std::setw(11) << strategy->coalesced.exchange(0, std::memory_order_relaxed) << "\n";
+        wait.reset();
+        strategy->evaluations = 0;
+    }
+}
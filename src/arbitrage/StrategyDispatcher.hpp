@@ -0,0 +1,89 @@
+#pragma once
+#include "exchange/MarketDataTypes.hpp"
+#include "monitoring/LatencyMonitor.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Runs strategies when the market data they read changes, instead of on a
+// fixed poll.
+//
+// Each strategy names the update keys it depends on (dense aggregator keys,
+// see MarketDataAggregator::keyFor). notify() marks those strategies pending
+// and wakes the dispatch loop. A strategy that is already pending is not
+// queued again: bursts coalesce into one evaluation on the latest state,
+// so a slow strategy never builds a backlog.
+//
+// All strategies and periodic tasks run on the thread that calls run(),
+// one at a time, so they keep the single-threaded assumptions of the
+// static engines they use (TradeExecutor, StatisticalArbitrageEngine, ...).
+class StrategyDispatcher {
+public:
+    using Task = std::function<void()>;
+
+    // Registration must finish before notify() is first called.
+    void addStrategy(const std::string& name, const std::vector<int>& triggers, Task task);
+    void addPeriodic(const std::string& name, std::chrono::milliseconds interval, Task task);
+
+    // Polled on the dispatch thread before every strategy pass (e.g. draining
+    // feed queues into the aggregator). Returns true if it left work behind,
+    // in which case the loop comes straight back instead of sleeping.
+    using Source = std::function<bool()>;
+    void addSource(Source source);
+
+    // Thread-safe; called from feed threads. `receivedAt` is when the
+    // triggering frame came off the socket (MonoTimestamp{} = now).
+    void notify(int key, MonoTimestamp receivedAt);
+
+    // Thread-safe; wakes the dispatch loop so it polls its sources.
+    void wake();
+
+    // Dispatch loop; blocks until stop() (which may come first).
+    void run();
+    void stop();
+
+    // One non-blocking pass at `now` instead of the clock: drains the
+    // sources, runs pending strategies and the periodics due by then. For
+    // feed_replay, which drives the dispatcher on recorded time.
+    void step(MonoTimestamp now);
+
+    // Per strategy: evaluations, coalesced updates, and wait from the oldest
+    // pending update's receive time to the start of its evaluation.
+    void printStats();
+
+private:
+    struct Strategy {
+        std::string name;
+        Task task;
+        std::atomic<int64_t> pendingSinceNs{0}; // 0 = not pending
+        std::atomic<uint64_t> coalesced{0};
+        uint64_t evaluations = 0;
+        LatencyHistogram wait;
+    };
+
+    struct Periodic {
+        std::string name;
+        std::chrono::milliseconds interval;
+        Task task;
+        MonoTimestamp due{}; // set on the first pass, on the clock that drives it
+    };
+
+    bool pollSources();
+    bool runPending(MonoTimestamp now);
+    MonoTimestamp runDuePeriodics(MonoTimestamp now);
+
+    std::vector<std::unique_ptr<Strategy>> strategies;
+    std::vector<std::vector<Strategy*>> byTrigger; // indexed by key
+    std::vector<Periodic> periodics;
+    std::vector<Source> sources;
+
+    std::mutex wakeMutex;
+    std::condition_variable wakeCv;
+    bool signaled = false;
+    std::atomic<bool> running{true};
+};
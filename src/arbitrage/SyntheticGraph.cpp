@@ -0,0 +1,179 @@
+#include "SyntheticGraph.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+
+namespace {
+    constexpr double UNSET = std::numeric_limits<double>::quiet_NaN();
+
+    bool same(double a, double b) {
+        return a == b || (std::isnan(a) && std::isnan(b));
+    }
+}
+
+SyntheticGraph::SyntheticGraph()
+    : legNodes(static_cast<size_t>(InstrumentRegistry::MAX_VENUES) * InstrumentRegistry::MAX_INSTRUMENTS * LEG_KINDS, -1) {}
+
+int SyntheticGraph::addNode(Op op, int left, int right, double value) {
+    ops.push_back(op);
+    lhs.push_back(left);
+    rhs.push_back(right);
+    values.push_back(value);
+    compiled = false;
+    return static_cast<int>(ops.size()) - 1;
+}
+
+SyntheticGraph::Expr SyntheticGraph::leg(VenueId venue, InstrumentId instrument, Leg kind) {
+    if (venue < 0 || venue >= InstrumentRegistry::MAX_VENUES || instrument < 0 || instrument >= InstrumentRegistry::MAX_INSTRUMENTS) {
+        std::cerr << "❌ SyntheticGraph: leg outside the registry (venue " << venue << ", instrument " << instrument << ")" << std::endl;
+        return constant(UNSET);
+    }
+    int& node = legNodes[(static_cast<size_t>(venue) * InstrumentRegistry::MAX_INSTRUMENTS + instrument) * LEG_KINDS + kind];
+    if (node < 0) node = addNode(Op::Leg, -1, -1, UNSET);
+    return {this, node};
+}
+
+SyntheticGraph::Expr SyntheticGraph::param(const std::string& name, double initial) {
+    auto [it, inserted] = params.try_emplace(name, -1);
+    if (inserted) it->second = addNode(Op::Param, -1, -1, initial);
+    return {this, it->second};
+}
+
+SyntheticGraph::Expr SyntheticGraph::constant(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof bits);
+    auto [it, inserted] = constants.try_emplace(bits, -1);
+    if (inserted) it->second = addNode(Op::Const, -1, -1, value);
+    return {this, it->second};
+}
+
+SyntheticGraph::Expr SyntheticGraph::binary(Op op, Expr a, Expr b) {
+    int left = a.node, right = b.node;
+    if ((op == Op::Add || op == Op::Mul) && left > right) std::swap(left, right);
+
+    // Same operation on the same operands is the same node
+    const uint64_t key = static_cast<uint64_t>(op) << 60 | static_cast<uint64_t>(left) << 30 | static_cast<uint64_t>(right);
+    auto [it, inserted] = shared.try_emplace(key, -1);
+    if (inserted) {
+        it->second = addNode(op, left, right, UNSET);
+        values[it->second] = evaluate(it->second);
+    }
+    return {this, it->second};
+}
+
+SyntheticId SyntheticGraph::define(const std::string& name, InstrumentId instrument, Expr expr) {
+    const int node = addNode(Op::Output, expr.node, -1, values[expr.node]);
+    synthetics.push_back({name, instrument, node});
+    return static_cast<SyntheticId>(synthetics.size()) - 1;
+}
+
+double SyntheticGraph::evaluate(int node) const {
+    switch (ops[node]) {
+        case Op::Add: return values[lhs[node]] + values[rhs[node]];
+        case Op::Sub: return values[lhs[node]] - values[rhs[node]];
+        case Op::Mul: return values[lhs[node]] * values[rhs[node]];
+        case Op::Div: return values[lhs[node]] / values[rhs[node]];
+        case Op::Output: return values[lhs[node]];
+        default: return values[node]; // leaves hold their input
+    }
+}
+
+void SyntheticGraph::compile() {
+    const int count = static_cast<int>(ops.size());
+    userOffsets.assign(count + 1, 0);
+    for (int node = 0; node < count; ++node) {
+        if (lhs[node] >= 0) ++userOffsets[lhs[node] + 1];
+        if (rhs[node] >= 0 && rhs[node] != lhs[node]) ++userOffsets[rhs[node] + 1];
+    }
+    for (int node = 0; node < count; ++node) userOffsets[node + 1] += userOffsets[node];
+
+    users.resize(userOffsets[count]);
+    std::vector<int> fill(userOffsets.begin(), userOffsets.end() - 1);
+    for (int node = 0; node < count; ++node) {
+        if (lhs[node] >= 0) users[fill[lhs[node]]++] = node;
+        if (rhs[node] >= 0 && rhs[node] != lhs[node]) users[fill[rhs[node]]++] = node;
+    }
+    dirty.assign((count + 63) / 64, 0);
+    compiled = true;
+}
+
+void SyntheticGraph::set(int node, double value) {
+    if (same(values[node], value)) return;
+    values[node] = value;
+    for (int i = userOffsets[node]; i < userOffsets[node + 1]; ++i) {
+        const int user = users[i];
+        const size_t word = static_cast<size_t>(user) >> 6;
+        dirty[word] |= uint64_t{1} << (user & 63);
+        firstDirty = std::min(firstDirty, word);
+        lastDirty = std::max(lastDirty, word);
+    }
+}
+
+void SyntheticGraph::propagate() {
+    // Ascending index order, so a node's operands are final before it runs.
+    // Users always have higher indices, so they land ahead of the scan.
+    for (size_t word = firstDirty; word <= lastDirty && word < dirty.size(); ++word) {
+        while (dirty[word]) {
+            const int bit = std::countr_zero(dirty[word]);
+            dirty[word] &= dirty[word] - 1;
+            const int node = static_cast<int>(word << 6) + bit;
+            ++evaluations;
+            set(node, evaluate(node));
+        }
+    }
+    firstDirty = SIZE_MAX;
+    lastDirty = 0;
+}
+
+void SyntheticGraph::update(const TopOfBook& top, double fundingRate) {
+    if (top.venue < 0 || top.venue >= InstrumentRegistry::MAX_VENUES) return;
+    if (top.instrument < 0 || top.instrument >= InstrumentRegistry::MAX_INSTRUMENTS) return;
+    if (top.bestBid <= 0 || top.bestAsk <= 0) return;
+    if (!compiled) compile();
+
+    const int* legs = &legNodes[(static_cast<size_t>(top.venue) * InstrumentRegistry::MAX_INSTRUMENTS + top.instrument) * LEG_KINDS];
+    if (legs[Mid] >= 0) set(legs[Mid], top.mid());
+    if (legs[Bid] >= 0) set(legs[Bid], top.bestBid);
+    if (legs[Ask] >= 0) set(legs[Ask], top.bestAsk);
+    if (legs[Funding] >= 0) set(legs[Funding], fundingRate);
+    propagate();
+}
+
+bool SyntheticGraph::setParam(const std::string& name, double value) {
+    auto it = params.find(name);
+    if (it == params.end()) {
+        std::cerr << "❌ SyntheticGraph: unknown parameter " << name << std::endl;
+        return false;
+    }
+    if (!compiled) compile();
+    set(it->second, value);
+    propagate();
+    return true;
+}
+
+double SyntheticGraph::value(SyntheticId id) const {
+    if (id < 0 || id >= static_cast<SyntheticId>(synthetics.size())) return UNSET;
+    return values[synthetics[id].node];
+}
+
+void SyntheticGraph::print(InstrumentId instrument) const {
+    std::cout << "\n=== Synthetic Instruments ===\n";
+    for (const auto& synthetic : synthetics) {
+        if (synthetic.instrument != instrument) continue;
+        std::cout << "🔹 " << synthetic.name << " - Price: ";
+        const double price = values[synthetic.node];
+        if (std::isnan(price)) std::cout << "(waiting for legs)\n";
+        else std::cout << std::fixed << std::setprecision(2) << price << "\n";
+    }
+}
+
+void SyntheticGraph::printStats() {
+    std::cout << "🧮 Synthetic graph: " << synthetics.size() << " synthetics, " << ops.size()
+              << " nodes, " << evaluations << " node evaluations since last report\n";
+    evaluations = 0;
+}
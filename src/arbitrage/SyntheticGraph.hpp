@@ -0,0 +1,130 @@
+#pragma once
+#include "exchange/MarketDataTypes.hpp"
+#include "exchange/InstrumentRegistry.hpp"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using SyntheticId = int;
+
+// Synthetic instruments defined as expressions over market legs and
+// parameters, evaluated incrementally.
+//
+// Legs are a venue's mid, bid, ask or funding rate for an instrument (an
+// FX conversion is just the mid of the FX pair); parameters are named
+// inputs such as a cost of carry or time to expiry. Definitions build a
+// DAG in which identical legs and identical subexpressions are shared, so
+// a thousand synthetics over the same spot legs compute each leg term once.
+//
+//   auto spot = graph.mid(okx, btc);
+//   graph.define("BTC/USDT Future (Carry)", btc,
+//                spot * (1.0 + graph.param("BTC carry", 0.05) * graph.param("BTC expiry", 0.25)));
+//
+// update() writes the legs from a quote and re-evaluates only the nodes
+// downstream of a leg that moved, in topological order; a node whose value
+// did not change stops the propagation there. Values are NaN until every
+// leg they use has been seen.
+//
+// Defined at startup, then updated and read on the dispatcher thread.
+class SyntheticGraph {
+public:
+    // Node handle used while defining synthetics.
+    class Expr {
+    public:
+        Expr operator+(Expr b) const { return graph->binary(Op::Add, *this, b); }
+        Expr operator-(Expr b) const { return graph->binary(Op::Sub, *this, b); }
+        Expr operator*(Expr b) const { return graph->binary(Op::Mul, *this, b); }
+        Expr operator/(Expr b) const { return graph->binary(Op::Div, *this, b); }
+        Expr operator+(double b) const { return *this + graph->constant(b); }
+        Expr operator-(double b) const { return *this - graph->constant(b); }
+        Expr operator*(double b) const { return *this * graph->constant(b); }
+        Expr operator/(double b) const { return *this / graph->constant(b); }
+        friend Expr operator+(double a, Expr b) { return b.graph->constant(a) + b; }
+        friend Expr operator-(double a, Expr b) { return b.graph->constant(a) - b; }
+        friend Expr operator*(double a, Expr b) { return b.graph->constant(a) * b; }
+        friend Expr operator/(double a, Expr b) { return b.graph->constant(a) / b; }
+
+    private:
+        friend class SyntheticGraph;
+        Expr(SyntheticGraph* graph, int node) : graph(graph), node(node) {}
+
+        SyntheticGraph* graph;
+        int node;
+    };
+
+    SyntheticGraph();
+    SyntheticGraph(const SyntheticGraph&) = delete;
+    SyntheticGraph& operator=(const SyntheticGraph&) = delete;
+
+    Expr mid(VenueId venue, InstrumentId instrument) { return leg(venue, instrument, Leg::Mid); }
+    Expr bid(VenueId venue, InstrumentId instrument) { return leg(venue, instrument, Leg::Bid); }
+    Expr ask(VenueId venue, InstrumentId instrument) { return leg(venue, instrument, Leg::Ask); }
+    Expr funding(VenueId venue, InstrumentId instrument) { return leg(venue, instrument, Leg::Funding); }
+    // Named input, created with `initial` on first use.
+    Expr param(const std::string& name, double initial);
+    Expr constant(double value);
+
+    // Names `expr` as a synthetic priced against `instrument`.
+    SyntheticId define(const std::string& name, InstrumentId instrument, Expr expr);
+
+    // Writes the quote's legs and the venue's funding rate, then propagates.
+    void update(const TopOfBook& top, double fundingRate);
+    // False (with a ❌) if the parameter was never defined.
+    bool setParam(const std::string& name, double value);
+
+    double value(SyntheticId id) const;
+    const std::string& name(SyntheticId id) const { return synthetics[id].name; }
+    InstrumentId instrument(SyntheticId id) const { return synthetics[id].instrument; }
+    size_t size() const { return synthetics.size(); }
+
+    // Every synthetic priced against the instrument, with its value.
+    void print(InstrumentId instrument) const;
+    // Node count and evaluations since the last call.
+    void printStats();
+
+private:
+    enum class Op : uint8_t { Leg, Param, Const, Add, Sub, Mul, Div, Output };
+    enum Leg { Mid, Bid, Ask, Funding, LEG_KINDS };
+
+    struct Synthetic {
+        std::string name;
+        InstrumentId instrument;
+        int node;
+    };
+
+    Expr leg(VenueId venue, InstrumentId instrument, Leg kind);
+    Expr binary(Op op, Expr a, Expr b);
+    int addNode(Op op, int lhs, int rhs, double value);
+    double evaluate(int node) const;
+    void set(int node, double value);
+    void propagate();
+    void compile();
+
+    // Nodes, in creation order: every operand precedes its users, so the
+    // index order is a topological order.
+    std::vector<Op> ops;
+    std::vector<int> lhs;
+    std::vector<int> rhs;
+    std::vector<double> values;
+
+    // Users of each node (CSR), rebuilt lazily after a definition
+    std::vector<int> userOffsets;
+    std::vector<int> users;
+    bool compiled = false;
+
+    // (venue * MAX_INSTRUMENTS + instrument) * LEG_KINDS + kind -> leg node, or -1
+    std::vector<int> legNodes;
+    std::unordered_map<uint64_t, int> shared;       // (op, lhs, rhs) -> node
+    std::unordered_map<uint64_t, int> constants;    // value bits -> node
+    std::unordered_map<std::string, int> params;    // name -> node
+
+    std::vector<Synthetic> synthetics;
+
+    // Nodes waiting to be re-evaluated, one bit each, and the word range
+    // holding them
+    std::vector<uint64_t> dirty;
+    size_t firstDirty = SIZE_MAX;
+    size_t lastDirty = 0;
+    uint64_t evaluations = 0;
+};
@@ -1,46 +1,54 @@
 #include "arbitrage/SyntheticInstrumentCalculator.hpp"
+#include "exchange/InstrumentRegistry.hpp"
 #include <iostream>
+#include <algorithm>
 #include <cmath>
 
-SyntheticInstrument SyntheticInstrumentCalculator::computeSyntheticSpot(const OrderBookUpdate& spotData, double leverage, double fundingRate) {
+namespace {
+    std::string symbolOf(const TopOfBook& book) {
+        return book.instrument >= 0 ? InstrumentRegistry::instrumentName(book.instrument) : std::string();
+    }
+}
+
+SyntheticInstrument SyntheticInstrumentCalculator::computeSyntheticSpot(const TopOfBook& spotData, double leverage, double fundingRate) {
     double mid = (spotData.bestBid + spotData.bestAsk) / 2.0;
     double syntheticPrice = mid * (1 + fundingRate * leverage);
 
     return {
         .type = "Synthetic Spot",
-        .symbol = spotData.symbol,
+        .symbol = symbolOf(spotData),
         .price = syntheticPrice,
-        .legA = spotData.symbol + "_PERP",
+        .legA = symbolOf(spotData) + "_PERP",
         .legB = "FundingAdj"
     };
 }
 
 SyntheticInstrument SyntheticInstrumentCalculator::computeSyntheticFuture_CarryModel(
-    const OrderBookUpdate& spotData, double costOfCarry, double timeToExpiryInYears) {
+    const TopOfBook& spotData, double costOfCarry, double timeToExpiryInYears) {
 
     double mid = (spotData.bestBid + spotData.bestAsk) / 2.0;
     double syntheticPrice = mid * (1 + costOfCarry * timeToExpiryInYears);
 
     return {
         .type = "Synthetic Future (Carry)",
-        .symbol = spotData.symbol,
+        .symbol = symbolOf(spotData),
         .price = syntheticPrice,
-        .legA = spotData.symbol + "_SPOT",
+        .legA = symbolOf(spotData) + "_SPOT",
         .legB = "CostOfCarry"
     };
 }
 
 SyntheticInstrument SyntheticInstrumentCalculator::computeSyntheticFuture_FundingModel(
-    const OrderBookUpdate& spotData, double fundingRate, double timeWindow) {
+    const TopOfBook& spotData, double fundingRate, double timeWindow) {
 
     double mid = (spotData.bestBid + spotData.bestAsk) / 2.0;
     double syntheticPrice = mid * (1 + fundingRate * timeWindow);
 
     return {
         .type = "Synthetic Future (Funding)",
-        .symbol = spotData.symbol,
+        .symbol = symbolOf(spotData),
         .price = syntheticPrice,
-        .legA = spotData.symbol + "_SPOT",
+        .legA = symbolOf(spotData) + "_SPOT",
         .legB = "FundingRate"
     };
 }
@@ -50,6 +58,12 @@ double SyntheticInstrumentCalculator::computeMispricing(double realPrice, double
     return ((realPrice - syntheticPrice) / syntheticPrice) * 100.0;
 }
 
+double SyntheticInstrumentCalculator::netEdgePercent(double realPrice, double syntheticPrice, double feePercent) {
+    const double gross = syntheticPrice > realPrice ? (syntheticPrice - realPrice) / realPrice
+                                                    : (realPrice - syntheticPrice) / syntheticPrice;
+    return gross * 100.0 - feePercent;
+}
+
 ArbitrageOpportunity SyntheticInstrumentCalculator::evaluateArbitrage(
     const std::string& symbol,
     const std::string& realExchange,
@@ -58,15 +72,16 @@ ArbitrageOpportunity SyntheticInstrumentCalculator::evaluateArbitrage(
     double syntheticPrice,
     double minProfitThreshold,
     double capital,
-    const OrderBookUpdate& realOrderBook,
-    const OrderBookUpdate& syntheticOrderBook
+    const TopOfBook& realOrderBook,
+    const TopOfBook& syntheticOrderBook,
+    double feePercent
 )
  {
     ArbitrageOpportunity result;
     result.symbol = symbol;
 
     if (syntheticPrice > realPrice) {
-    double profitPct = ((syntheticPrice - realPrice) / realPrice) * 100.0;
+    double profitPct = ((syntheticPrice - realPrice) / realPrice) * 100.0 - feePercent;
     if (profitPct >= minProfitThreshold) {
         result = {
             .symbol = symbol,
@@ -84,11 +99,11 @@ ArbitrageOpportunity SyntheticInstrumentCalculator::evaluateArbitrage(
         std::cout << "🔹 Symbol: " << symbol << "\n";
         std::cout << "🟢 Buy: " << result.longExchange << " at " << result.longPrice << "\n";
         std::cout << "🔴 Sell: " << result.shortExchange << " at " << result.shortPrice << "\n";
-        std::cout << "📈 Profit: " << profitPct << "%\n";
+        std::cout << "📈 Profit after fees: " << profitPct << "%\n";
         std::cout << "💵 Capital Required: " << capital << " USDT\n\n";
     }
 } else if (realPrice > syntheticPrice) {
-    double profitPct = ((realPrice - syntheticPrice) / syntheticPrice) * 100.0;
+    double profitPct = ((realPrice - syntheticPrice) / syntheticPrice) * 100.0 - feePercent;
     if (profitPct >= minProfitThreshold) {
         result = {
             .symbol = symbol,
@@ -104,7 +119,7 @@ ArbitrageOpportunity SyntheticInstrumentCalculator::evaluateArbitrage(
     }
 }
  else if (realPrice > syntheticPrice) {
-        double profitPct = ((realPrice - syntheticPrice) / syntheticPrice) * 100.0;
+        double profitPct = ((realPrice - syntheticPrice) / syntheticPrice) * 100.0 - feePercent;
         if (profitPct >= minProfitThreshold) {
             result.longExchange = syntheticExchange;
             result.shortExchange = realExchange;
@@ -117,3 +132,72 @@ ArbitrageOpportunity SyntheticInstrumentCalculator::evaluateArbitrage(
 
     return result;
 }
+
+double SyntheticInstrumentCalculator::optimalArbitrageSize(const DepthLadder& asks, const DepthLadder& bids, double longFee, double shortFee) {
+    if (asks.levels() == 0 || bids.levels() == 0) return 0.0;
+    const double limit = std::min(asks.totalQty(), bids.totalQty());
+
+    // Net edge of the last unit at q; only falls as q grows (asks rise, bids fall)
+    auto clears = [&](double q) {
+        return bids.marginalPrice(q) * (1.0 - shortFee) > asks.marginalPrice(q) * (1.0 + longFee);
+    };
+
+    // The edge only changes at a level boundary, so the best size is the
+    // last boundary, on either ladder, whose units still clear
+    auto lastClearing = [&](const DepthLadder& ladder) {
+        size_t lo = 0, hi = ladder.levels(); // boundaries [0, lo) clear, [hi, levels) do not
+        while (lo < hi) {
+            const size_t mid = (lo + hi) / 2;
+            const double q = std::min(ladder.qtyThrough(mid), limit);
+            if (clears(q)) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo == 0 ? 0.0 : std::min(ladder.qtyThrough(lo - 1), limit);
+    };
+    return std::max(lastClearing(asks), lastClearing(bids));
+}
+
+ArbitrageOpportunity SyntheticInstrumentCalculator::evaluateExecutableArbitrage(
+    const std::string& symbol,
+    const std::string& longExchange,
+    const std::string& shortExchange,
+    const DepthLadder& asks,
+    const DepthLadder& bids,
+    double longFee,
+    double shortFee,
+    double minProfitThreshold,
+    double maxCapital,
+    const TopOfBook& longBook,
+    const TopOfBook& shortBook
+) {
+    ArbitrageOpportunity result;
+    result.symbol = symbol;
+
+    const double qty = std::min(optimalArbitrageSize(asks, bids, longFee, shortFee), asks.qtyFor(maxCapital / (1.0 + longFee)));
+    if (qty <= 0.0) return result;
+
+    const double spent = asks.cost(qty) * (1.0 + longFee);
+    const double received = bids.cost(qty) * (1.0 - shortFee);
+    const double profitPct = (received - spent) / spent * 100.0;
+    if (profitPct < minProfitThreshold) return result;
+
+    result = {
+        .symbol = symbol,
+        .longExchange = longExchange,
+        .shortExchange = shortExchange,
+        .longPrice = asks.vwap(qty),
+        .shortPrice = bids.vwap(qty),
+        .profitPercentage = profitPct,
+        .capital = spent,
+        .longBook = longBook,
+        .shortBook = shortBook
+    };
+
+    std::cout << "\n💰 Executable Arbitrage Opportunity Detected:\n";
+    std::cout << "🔹 Symbol: " << symbol << "\n";
+    std::cout << "🟢 Buy: " << qty << " on " << longExchange << " at VWAP " << result.longPrice << " (best " << asks.price(0) << ")\n";
+    std::cout << "🔴 Sell: " << qty << " on " << shortExchange << " at VWAP " << result.shortPrice << " (best " << bids.price(0) << ")\n";
+    std::cout << "📈 Profit after fees: " << profitPct << "% (" << received - spent << " USDT)\n";
+    std::cout << "💵 Capital Required: " << spent << " USDT\n\n";
+    return result;
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "exchange/MarketDataTypes.hpp"
 #include "ArbitrageOpportunity.hpp"
+#include "DepthLadder.hpp"
 
 struct SyntheticInstrument {
     std::string type;
@@ -12,14 +13,19 @@ struct SyntheticInstrument {
 
 class SyntheticInstrumentCalculator {
 public:
-    static SyntheticInstrument computeSyntheticSpot(const OrderBookUpdate& spotData, double leverage, double fundingRate);
+    static SyntheticInstrument computeSyntheticSpot(const TopOfBook& spotData, double leverage, double fundingRate);
 
-    static SyntheticInstrument computeSyntheticFuture_CarryModel(const OrderBookUpdate& spotData, double costOfCarry, double timeToExpiryInYears);
+    static SyntheticInstrument computeSyntheticFuture_CarryModel(const TopOfBook& spotData, double costOfCarry, double timeToExpiryInYears);
 
-    static SyntheticInstrument computeSyntheticFuture_FundingModel(const OrderBookUpdate& spotData, double fundingRate, double timeWindow);
+    static SyntheticInstrument computeSyntheticFuture_FundingModel(const TopOfBook& spotData, double fundingRate, double timeWindow);
 
     static double computeMispricing(double realPrice, double syntheticPrice);
 
+    // Net edge, in percent, of buying the cheaper of the two prices and
+    // selling the dearer (as evaluateArbitrage trades them) after
+    // feePercent. Negative when the fees outweigh the gap.
+    static double netEdgePercent(double realPrice, double syntheticPrice, double feePercent);
+
 static ArbitrageOpportunity evaluateArbitrage(
     const std::string& symbol,
     const std::string& realExchange,
@@ -28,8 +34,32 @@ static ArbitrageOpportunity evaluateArbitrage(
     double syntheticPrice,
     double minProfitThreshold,
     double capital,
-    const OrderBookUpdate& realOrderBook,
-    const OrderBookUpdate& syntheticOrderBook
+    const TopOfBook& realOrderBook,
+    const TopOfBook& syntheticOrderBook,
+    double feePercent = 0.0   // round-trip fees, taken off the edge before the threshold
 );
 
+    // Executable mode: buys on `asks` and sells on `bids` at their VWAPs,
+    // each leg net of its taker fee, at the size that maximizes the net
+    // profit (optimalArbitrageSize, capped so the buy leg costs at most
+    // maxCapital). Prices in the result are the two VWAPs.
+    static ArbitrageOpportunity evaluateExecutableArbitrage(
+        const std::string& symbol,
+        const std::string& longExchange,
+        const std::string& shortExchange,
+        const DepthLadder& asks,
+        const DepthLadder& bids,
+        double longFee,
+        double shortFee,
+        double minProfitThreshold,
+        double maxCapital,
+        const TopOfBook& longBook,
+        const TopOfBook& shortBook
+    );
+
+    // Size past which the next unit bought on `asks` costs more, after
+    // fees, than it sells for on `bids`. Binary search over the level
+    // boundaries of both ladders.
+    static double optimalArbitrageSize(const DepthLadder& asks, const DepthLadder& bids, double longFee, double shortFee);
+
 };
@@ -77,6 +77,46 @@ void TradeExecutor::executeTrade(const ArbitrageOpportunity& opp) {
     std::cout << "📈 Profit: " << std::fixed << std::setprecision(2) << profit << " USDT\n";
 }
 
+void TradeExecutor::executeMultiLeg(const MultiLegOpportunity& opp) {
+    if (opp.capital <= 0.0 || opp.legs.empty()) {
+        std::cerr << "❌ Trade rejected: Capital is zero or negative.\n";
+        return;
+    }
+
+    // Every leg's proceeds fund the next one
+    double amount = opp.capital;
+    for (const auto& leg : opp.legs) {
+        if (leg.price <= 0.0) {
+            std::cerr << "❌ Trade rejected: no price for " << leg.symbol << " on " << leg.exchange << "\n";
+            return;
+        }
+        amount = leg.buy ? amount / leg.price * (1.0 - leg.fee) : amount * leg.price * (1.0 - leg.fee);
+    }
+    double profit = amount - opp.capital;
+
+    ExecutedTrade trade{
+        .symbol = opp.route,
+        .buyExchange = opp.legs.front().exchange,
+        .sellExchange = opp.legs.back().exchange,
+        .buyPrice = opp.legs.front().price,
+        .sellPrice = opp.legs.back().price,
+        .capitalUsed = opp.capital,
+        .profit = profit,
+        .timestamp = std::chrono::system_clock::now()
+    };
+
+    tradeHistory.push_back(trade);
+    totalProfit += profit;
+    VaREstimator::addPnL(profit);
+
+    std::cout << "\n✅ Executed Multi-Leg Trade:\n";
+    std::cout << "🔹 Route: " << opp.route << "\n";
+    for (const auto& leg : opp.legs)
+        std::cout << (leg.buy ? "🟢 Buy: " : "🔴 Sell: ") << leg.symbol << " on " << leg.exchange << " at " << leg.price << "\n";
+    std::cout << "💰 Capital Used: " << opp.capital << " " << opp.currency << "\n";
+    std::cout << "📈 Profit: " << std::fixed << std::setprecision(2) << profit << " " << opp.currency << "\n";
+}
+
 
 
 double TradeExecutor::getTotalProfit() {
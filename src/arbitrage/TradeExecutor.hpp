@@ -20,6 +20,8 @@ struct ExecutedTrade {
 class TradeExecutor {
 public:
     static void executeTrade(const ArbitrageOpportunity& opp);
+    // Converts opp.capital through every leg at its quoted price, net of fees.
+    static void executeMultiLeg(const MultiLegOpportunity& opp);
     static double getTotalProfit();
     static int getTradeCount();
     static const std::vector<ExecutedTrade>& getTradeHistory();
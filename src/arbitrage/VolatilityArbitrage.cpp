@@ -17,10 +17,11 @@ namespace VolatilityArbitrage {
     }
 
     void checkVolatilityArbitrage(MarketDataAggregator& aggregator) {
-        const auto& latestUpdates = aggregator.getLatestUpdates();
+        static const VenueId okx = InstrumentRegistry::registerVenue("OKX");
+        static const InstrumentId btc = InstrumentRegistry::registerInstrument("BTC/USDT");
 
-        if (!latestUpdates.count("OKX")) return;
-        const auto& okxSpot = latestUpdates.at("OKX");
+        TopOfBook okxSpot;
+        if (!aggregator.getLatest(okx, btc, okxSpot)) return;
 
         double spotPrice = (okxSpot.bestBid + okxSpot.bestAsk) / 2.0;
 
@@ -1,5 +1,10 @@
 #include "BinanceClient.hpp"
 #include "MarketDataTypes.hpp"
+#include "BookTickerParser.hpp"
+#include "TransportManager.hpp"
+#include "FeedJournal.hpp"
+#include "InstrumentRegistry.hpp"
+#include "monitoring/SequenceMonitor.hpp"
 #include <websocketpp/config/asio_client.hpp>
 #include <websocketpp/client.hpp>
 #include <asio/ssl.hpp>
@@ -8,6 +13,7 @@
 #include <string>
 #include <thread>
 #include <filesystem>
+#include <algorithm>
 
 using json = nlohmann::json;
 using context_ptr = std::shared_ptr<asio::ssl::context>;
@@ -39,59 +45,106 @@ context_ptr on_tls_init(websocketpp::connection_hdl) {
 
 
 BinanceClient::BinanceClient(const std::string& symbol)
-    : symbol(symbol), connected(false) {}
+    : BinanceClient(std::vector<std::string>{symbol}) {}
+
+BinanceClient::BinanceClient(const std::vector<std::string>& symbols)
+    : sequenceVenue(InstrumentRegistry::registerVenue("Binance")), connected(false) {
+    for (const auto& s : symbols) {
+        std::string lower = s, upper = s;
+        std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+        std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+
+        // Stream names are lowercase, payload "s" fields are uppercase
+        int id = symbolTable.add(upper);
+        if (id == static_cast<int>(streamSymbols.size())) {
+            streamSymbols.push_back(lower);
+            OrderBookUpdate update{};
+            update.symbol = upper;
+            update.instrument = InstrumentRegistry::registerInstrument(upper);
+            latestUpdates.push_back(update);
+        }
+    }
+    lastUpdateIds.assign(latestUpdates.size(), 0);
+}
+
+std::vector<std::string> BinanceClient::buildStreamUrls() const {
+    std::vector<std::string> urls;
+    for (size_t i = 0; i < streamSymbols.size(); i += MAX_STREAMS_PER_CONNECTION) {
+        std::string url = (endpoint.empty() ? "wss://stream.binance.com:443" : endpoint) + "/stream?streams=";
+        size_t last = std::min(i + MAX_STREAMS_PER_CONNECTION, streamSymbols.size());
+        for (size_t k = i; k < last; ++k) {
+            if (k != i) url += "/";
+            url += streamSymbols[k] + "@bookTicker";
+        }
+        urls.push_back(url);
+    }
+    return urls;
+}
 
 void BinanceClient::connect() {
     client.set_access_channels(websocketpp::log::alevel::all);
     client.clear_access_channels(websocketpp::log::alevel::frame_payload);
     client.set_error_channels(websocketpp::log::elevel::all);
 
-    client.init_asio();
-    client.start_perpetual();  // 🔄 Keeps io_service running
+    if (transport) {
+        client.init_asio(&transport->assign(name()));
+    } else {
+        client.init_asio();
+        client.start_perpetual();  // 🔄 Keeps io_service running
+    }
 
     client.set_tls_init_handler([](websocketpp::connection_hdl hdl) {
         return on_tls_init(hdl);
     });
 
-    std::string url = "wss://stream.binance.com:443/stream?streams=" + symbol + "@bookTicker";
-    // std::string url="wss://stream.binance.com:443/stream?streams=btcusdt@bookTicker";
-
-    // std::cout << "GET URL: " << url << std::endl;
-
+    // One combined-stream connection per batch of symbols, all on the same endpoint
+    for (const auto& url : buildStreamUrls()) {
+        websocketpp::lib::error_code ec;
+        auto con = client.get_connection(url, ec);
 
-    client.set_message_handler([this](ws_connection_hdl, ws_client::message_ptr msg) {
-        handleIncomingMessage(msg->get_payload());
-    });
+        if (ec) {
+            std::cout << "❌ Connection error: " << ec.message() << std::endl;
+            continue;
+        }
 
-    websocketpp::lib::error_code ec;
-    auto con = client.get_connection(url, ec);
+        // Per-connection handler so recorded frames keep their stream index
+        const auto streamId = static_cast<uint16_t>(connHdls.size());
+        con->set_message_handler([this, streamId](ws_connection_hdl, ws_client::message_ptr msg) {
+            const auto received = ReceiveTime::now();
+            if (journal) journal->append(FeedVenue::Binance, streamId, msg->get_payload(), received);
+            handleIncomingMessage(msg->get_payload(), received);
+        });
 
-    if (ec) {
-        std::cout << "❌ Connection error: " << ec.message() << std::endl;
-        return;
+        connHdls.push_back(con->get_handle()); // ✅ Save connection handle
+        client.connect(con);
     }
 
-    conn_hdl = con->get_handle(); // ✅ Save connection handle
-    client.connect(con);
-
-    runThread = std::thread([this]() {
-        client.run();
-    });
+    if (!transport) {
+        runThread = std::thread([this]() {
+            client.run();
+        });
+    }
 
     connected = true;
-    std::cout << "🔌 Connected to Binance spot " << "\n";
+    std::cout << "🔌 Connected to Binance spot (" << streamSymbols.size() << " symbols, "
+              << connHdls.size() << " connection(s))\n";
 }
 
 void BinanceClient::disconnect() {
     if (connected) {
-        websocketpp::lib::error_code ec;
+        for (auto& hdl : connHdls) {
+            websocketpp::lib::error_code ec;
 
-        client.close(conn_hdl, websocketpp::close::status::going_away, "Client disconnect", ec);
-        if (ec) {
-            std::cerr << "❌ Close error: " << ec.message() << std::endl;
+            client.close(hdl, websocketpp::close::status::going_away, "Client disconnect", ec);
+            if (ec) {
+                std::cerr << "❌ Close error: " << ec.message() << std::endl;
+            }
         }
+        connHdls.clear();
 
-        client.stop_perpetual();
+        if (!transport) {
+            client.stop_perpetual();
+        }
 
         if (runThread.joinable()) {
             runThread.join();
@@ -102,17 +155,56 @@ void BinanceClient::disconnect() {
     }
 }
 
-void BinanceClient::handleIncomingMessage(const std::string& msg) {
+bool BinanceClient::acceptUpdateId(int id, int64_t updateId) {
+    // Each bookTicker is the whole top of book, so a skipped u needs no
+    // resync (the stream conflates); an older or repeated u is stale.
+    if (!updateId) return true;
+    if (updateId <= lastUpdateIds[id]) {
+        SequenceMonitor::recordDropped(sequenceVenue);
+        return false;
+    }
+    lastUpdateIds[id] = updateId;
+    return true;
+}
+
+void BinanceClient::resetSequences() {
+    std::fill(lastUpdateIds.begin(), lastUpdateIds.end(), 0);
+}
+
+void BinanceClient::handleIncomingMessage(const std::string& msg, const ReceiveTime& received) {
     try {
-        auto j = json::parse(msg);
-        auto data = j["data"];
+        // Fast path: in-place scan of the known bookTicker shape, dispatched
+        // to the symbol's slot by id. Anything unexpected goes through the
+        // full JSON parser.
+        BookTicker ticker;
+        if (BookTickerParser::parse(msg, ticker)) {
+            int id = symbolTable.find(ticker.symbol);
+            if (id == SymbolTable::NOT_FOUND || !acceptUpdateId(id, ticker.updateId)) return;
+
+            OrderBookUpdate& update = latestUpdates[id];
+            update.bestBid = ticker.bid;
+            update.bestAsk = ticker.ask;
+            update.bestBidQty = ticker.bidQty;
+            update.bestAskQty = ticker.askQty;
+            update.exchangeTime = ticker.eventTime ? Timestamp(std::chrono::milliseconds(ticker.eventTime)) : Timestamp{};
+            update.timestamp = received.wall;
+            update.receiveTime = received.mono;
+
+            if (orderBookCallback) {
+                orderBookCallback(update);
+            }
+            return;
+        }
 
         OrderBookUpdate update;
-        update.symbol = data.value("s", "");
-        update.bestBid = std::stod(data.value("b", "0.0"));
-        update.bestAsk = std::stod(data.value("a", "0.0"));
-        update.bestBidQty = std::stod(data.value("B", "0.0"));  
-        update.bestAskQty = std::stod(data.value("A", "0.0")); 
+        int64_t updateId = 0;
+        if (!BookTickerParser::parseWithJson(msg, update, updateId)) return;
+        int id = symbolTable.find(update.symbol);
+        if (id == SymbolTable::NOT_FOUND || !acceptUpdateId(id, updateId)) return;
+
+        update.instrument = latestUpdates[id].instrument;
+        update.timestamp = received.wall;
+        update.receiveTime = received.mono;
 
         if (orderBookCallback) {
             orderBookCallback(update);
@@ -1,23 +1,44 @@
 #pragma once
 #include "ExchangeClient.hpp"
+#include "MarketDataTypes.hpp"
+#include "SymbolTable.hpp"
 #include <websocketpp/config/asio_client.hpp>
 #include <websocketpp/client.hpp>
 #include <thread>
+#include <vector>
 
 using ws_client = websocketpp::client<websocketpp::config::asio_tls_client>;
 
 class BinanceClient : public ExchangeClient {
 public:
-    void handleIncomingMessage(const std::string& msg);
     BinanceClient(const std::string& symbol);
+    BinanceClient(const std::vector<std::string>& symbols);
     void connect() override;
     void disconnect() override;
     std::string name() const override { return "Binance"; }
+    void handleIncomingMessage(const std::string& msg, const ReceiveTime& received) override;
+    void resetSequences() override;
 
 private:
-    std::string symbol;
+    // Binance allows 1024 streams per connection, but the combined-stream
+    // URL grows ~20 bytes per stream; 200 keeps the request line well
+    // under typical 8 KB limits.
+    static constexpr size_t MAX_STREAMS_PER_CONNECTION = 200;
+
+    std::vector<std::string> buildStreamUrls() const;
+
+    // False (and counted as dropped) if `updateId` is not newer than the
+    // last one applied for `id`. Shared by the fast and JSON parse paths.
+    bool acceptUpdateId(int id, int64_t updateId);
+
+    SymbolTable symbolTable;                  // "BTCUSDT" -> id
+    std::vector<std::string> streamSymbols;   // id -> "btcusdt"
+    std::vector<OrderBookUpdate> latestUpdates; // id -> reusable update slot
+    std::vector<int64_t> lastUpdateIds;         // id -> last bookTicker "u" applied
+    VenueId sequenceVenue;                      // InstrumentRegistry id, for SequenceMonitor
+
     bool connected = false;
     ws_client client;
     std::thread runThread;
-    websocketpp::connection_hdl conn_hdl; // ✅ Moved here
+    std::vector<websocketpp::connection_hdl> connHdls; // ✅ One per combined stream
 };
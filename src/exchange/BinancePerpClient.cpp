@@ -1,7 +1,9 @@
 #include "exchange/BinancePerpClient.hpp"
+#include "exchange/TransportManager.hpp"
+#include "exchange/FeedJournal.hpp"
 #include <iostream>
 #include <filesystem>
-#include <iomanip>
+#include <algorithm>
 
 using websocketpp::lib::error_code;
 using json = nlohmann::json;
@@ -12,19 +14,26 @@ BinancePerpClient::BinancePerpClient(const std::string& symbol)
     std::transform(lowerSymbol.begin(), lowerSymbol.end(), lowerSymbol.begin(), ::tolower);
 
     ws.clear_access_channels(websocketpp::log::alevel::all);
-    ws.init_asio();
 
     ws.set_tls_init_handler([](websocketpp::connection_hdl) {
         return std::make_shared<asio::ssl::context>(asio::ssl::context::tlsv12_client);
     });
 
     ws.set_message_handler([this](websocketpp::connection_hdl, auto msg) {
-        handleIncomingMessage(msg->get_payload());
+        const auto received = ReceiveTime::now();
+        if (journal) journal->append(FeedVenue::BinancePerp, 0, msg->get_payload(), received);
+        handleIncomingMessage(msg->get_payload(), received);
     });
 }
 
 void BinancePerpClient::connect() {
-    std::string uri = "wss://fstream.binance.com/ws/!markPrice@arr";
+    std::string uri = (endpoint.empty() ? "wss://fstream.binance.com" : endpoint) + "/ws/!markPrice@arr";
+
+    if (transport) {
+        ws.init_asio(&transport->assign(name()));
+    } else {
+        ws.init_asio();
+    }
 
     error_code ec;
     auto con = ws.get_connection(uri, ec);
@@ -38,9 +47,11 @@ void BinancePerpClient::connect() {
 
     connected = true;
 
-    wsThread = std::thread([this]() {
-        ws.run();
-    });
+    if (!transport) {
+        wsThread = std::thread([this]() {
+            ws.run();
+        });
+    }
 
     std::cout << "🔌 Connected to Binance perpetual\n";
 }
@@ -57,7 +68,46 @@ void BinancePerpClient::disconnect() {
     }
 }
 
-void BinancePerpClient::handleIncomingMessage(const std::string& payload) {
+void BinancePerpClient::watchSymbols(const std::vector<std::string>& symbols) {
+    for (auto s : symbols) {
+        std::transform(s.begin(), s.end(), s.begin(), ::toupper);
+        watched.add(s);
+    }
+
+    std::string upper = symbol;
+    std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+    primarySymbolId = watched.add(upper);
+
+    for (size_t id = watchedInstruments.size(); id < watched.size(); ++id) {
+        watchedInstruments.push_back(InstrumentRegistry::registerInstrument(watched.name(static_cast<int>(id))));
+    }
+
+    batch.reserve(watched.size());
+}
+
+void BinancePerpClient::handleIncomingMessage(const std::string& payload, const ReceiveTime& received) {
+    lastReceive = received;
+
+    if (watched.size() == 0 || !MarkPriceParser::parse(payload, watched, batch)) {
+        handleWithJson(payload);
+        return;
+    }
+
+    if (markPriceBatchCallback && !batch.empty()) {
+        markPriceBatchCallback(batch);
+    }
+
+    if (markPriceCallback) {
+        for (const auto& entry : batch) {
+            if (entry.symbolId == primarySymbolId) {
+                markPriceCallback(entry.markPrice, entry.fundingRate);
+                break;
+            }
+        }
+    }
+}
+
+void BinancePerpClient::handleWithJson(const std::string& payload) {
     try {
         auto j = nlohmann::json::parse(payload);
 
@@ -66,19 +116,44 @@ void BinancePerpClient::handleIncomingMessage(const std::string& payload) {
             return;
         }
 
-        for (const auto& entry : j) {
-            if (entry.contains("s") && entry["s"] == "BTCUSDT") {
-                double mark = std::stod(entry["p"].get<std::string>());
-                double funding = std::stod(entry["r"].get<std::string>());
+        std::string upper = symbol;
+        std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
 
-                std::cout << std::fixed << std::setprecision(10);
-                std::cout << "[DEBUG] Parsed fundingRate: " << funding << ", markPrice: " << mark << std::endl;
+        batch.clear();
+        bool primaryFound = false;
+        double primaryMark = 0.0;
+        double primaryFunding = 0.0;
 
-                if (markPriceCallback) {
-                    markPriceCallback(mark, funding);
-                }
-                break;
+        for (const auto& entry : j) {
+            if (!entry.contains("s") || !entry["s"].is_string()) continue;
+            const auto& s = entry["s"].get_ref<const std::string&>();
+
+            const int id = watched.find(s);
+            const bool primary = id == SymbolTable::NOT_FOUND ? s == upper : id == primarySymbolId;
+            if (id == SymbolTable::NOT_FOUND && !primary) continue;
+
+            MarkPriceEntry parsed;
+            parsed.symbolId = id;
+            parsed.markPrice = std::stod(entry["p"].get<std::string>());
+            parsed.fundingRate = std::stod(entry["r"].get<std::string>());
+            if (entry.contains("i")) parsed.indexPrice = std::stod(entry["i"].get<std::string>());
+            if (entry.contains("T")) parsed.nextFundingTime = entry["T"].get<int64_t>();
+            if (entry.contains("E")) parsed.eventTime = entry["E"].get<int64_t>();
+
+            if (primary) {
+                primaryFound = true;
+                primaryMark = parsed.markPrice;
+                primaryFunding = parsed.fundingRate;
             }
+            if (id != SymbolTable::NOT_FOUND) batch.push_back(parsed);
+        }
+
+        if (markPriceBatchCallback && !batch.empty()) {
+            markPriceBatchCallback(batch);
+        }
+
+        if (markPriceCallback && primaryFound) {
+            markPriceCallback(primaryMark, primaryFunding);
         }
     } catch (const std::exception& e) {
         std::cerr << "❌ BinancePerpClient parse error: " << e.what() << std::endl;
@@ -7,8 +7,17 @@
 #include <functional>
 #include <string>
 #include <thread>
+#include <vector>
+#include "exchange/MarketDataTypes.hpp"
+#include "exchange/MarkPriceParser.hpp"
+#include "exchange/SymbolTable.hpp"
+#include "exchange/InstrumentRegistry.hpp"
+
+class TransportManager;
+class FeedJournalWriter;
 
 using MarkPriceCallback = std::function<void(double markPrice, double fundingRate)>;
+using MarkPriceBatchCallback = std::function<void(const std::vector<MarkPriceEntry>& entries)>;
 
 class BinancePerpClient {
 public:
@@ -17,10 +26,26 @@ public:
     void disconnect();
 
     void setMarkPriceCallback(MarkPriceCallback cb) { markPriceCallback = std::move(cb); }
+    void useTransport(TransportManager& manager) { transport = &manager; }
+    void setJournal(FeedJournalWriter* writer) { journal = writer; }
+    void setEndpoint(const std::string& baseUri) { endpoint = baseUri; }
+
+    // Selective mode: only these symbols are extracted from !markPrice@arr
+    // (single pass, hash lookup per entry) and delivered together through
+    // the batch callback. MarkPriceCallback keeps firing for `symbol`.
+    void watchSymbols(const std::vector<std::string>& symbols);
+    void setMarkPriceBatchCallback(MarkPriceBatchCallback cb) { markPriceBatchCallback = std::move(cb); }
+    const std::string& symbolName(int id) const { return watched.name(id); }
+    InstrumentId instrumentId(int id) const { return watchedInstruments[id]; }
+    // Receive time of the frame currently being delivered (valid inside callbacks).
+    const ReceiveTime& lastReceiveTime() const { return lastReceive; }
     std::string name() const { return "BinancePerp"; }
 
+    // Parse one raw frame (socket handler or feed replay).
+    void handleIncomingMessage(const std::string& message, const ReceiveTime& received);
+
 private:
-    void handleIncomingMessage(const std::string& message);
+    void handleWithJson(const std::string& payload);
 
     std::string symbol;
     std::string lowerSymbol;
@@ -30,4 +55,14 @@ private:
     std::thread wsThread;
 
     MarkPriceCallback markPriceCallback;
+    MarkPriceBatchCallback markPriceBatchCallback;
+
+    SymbolTable watched;            // "BTCUSDT" -> id
+    std::vector<InstrumentId> watchedInstruments; // id -> registry instrument
+    int primarySymbolId = SymbolTable::NOT_FOUND;
+    std::vector<MarkPriceEntry> batch; // reused across frames
+    ReceiveTime lastReceive{};
+    TransportManager* transport = nullptr;
+    FeedJournalWriter* journal = nullptr;
+    std::string endpoint; // empty = live venue
 };
@@ -0,0 +1,130 @@
+#include "exchange/BookTickerParser.hpp"
+#include "exchange/JsonScan.hpp"
+#include <nlohmann/json.hpp>
+#include <string>
+
+using json = nlohmann::json;
+
+using namespace JsonScan;
+
+namespace {
+    struct BookTickerFields {
+        std::string_view symbol, bid, bidQty, ask, askQty, eventTime, updateId;
+    };
+
+    // Walks the flat "data" object and records views of the fields we need.
+    bool scanDataObject(const char*& p, const char* end, BookTickerFields& fields) {
+        p = skipWhitespace(p, end);
+        if (p >= end || *p != '{') return false;
+        p = skipWhitespace(p + 1, end);
+
+        if (p < end && *p == '}') {
+            ++p;
+            return false;
+        }
+
+        while (p < end) {
+            std::string_view key, value;
+            if (!readKey(p, end, key)) return false;
+            if (!readScalar(p, end, value)) return false;
+
+            if (key.size() == 1) {
+                switch (key[0]) {
+                    case 's': fields.symbol = value; break;
+                    case 'b': fields.bid = value; break;
+                    case 'B': fields.bidQty = value; break;
+                    case 'a': fields.ask = value; break;
+                    case 'A': fields.askQty = value; break;
+                    case 'E': fields.eventTime = value; break;
+                    case 'u': fields.updateId = value; break;
+                    default: break;
+                }
+            }
+
+            if (!nextMember(p, end, '}')) return false;
+            if (*p == '}') {
+                ++p;
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+bool BookTickerParser::parse(std::string_view payload, BookTicker& ticker) {
+    const char* p = payload.data();
+    const char* end = p + payload.size();
+
+    p = skipWhitespace(p, end);
+    if (p >= end || *p != '{') return false;
+    p = skipWhitespace(p + 1, end);
+
+    BookTickerFields fields;
+    bool sawData = false;
+
+    while (p < end && *p != '}') {
+        std::string_view key;
+        if (!readKey(p, end, key)) return false;
+
+        if (key == "data") {
+            if (!scanDataObject(p, end, fields)) return false;
+            sawData = true;
+        } else {
+            std::string_view ignored;
+            if (!readScalar(p, end, ignored)) return false;
+        }
+
+        p = skipWhitespace(p, end);
+        if (p < end && *p == ',') p = skipWhitespace(p + 1, end);
+    }
+
+    // A frame cut off after "data" must not pass for a complete one
+    if (p >= end || !sawData || fields.symbol.empty()) return false;
+
+    if (!toDouble(fields.bid, ticker.bid) || !toDouble(fields.bidQty, ticker.bidQty) ||
+        !toDouble(fields.ask, ticker.ask) || !toDouble(fields.askQty, ticker.askQty)) {
+        return false;
+    }
+
+    ticker.eventTime = 0;
+    if (!fields.eventTime.empty() && !toInt64(fields.eventTime, ticker.eventTime)) return false;
+    ticker.updateId = 0;
+    if (!fields.updateId.empty() && !toInt64(fields.updateId, ticker.updateId)) return false;
+
+    ticker.symbol = fields.symbol;
+    return true;
+}
+
+bool BookTickerParser::parse(std::string_view payload, OrderBookUpdate& update) {
+    BookTicker ticker;
+    if (!parse(payload, ticker)) return false;
+
+    update.symbol.assign(ticker.symbol.data(), ticker.symbol.size()); // fits in SSO for exchange symbols
+    update.bestBid = ticker.bid;
+    update.bestAsk = ticker.ask;
+    update.bestBidQty = ticker.bidQty;
+    update.bestAskQty = ticker.askQty;
+    update.exchangeTime = ticker.eventTime ? Timestamp(std::chrono::milliseconds(ticker.eventTime)) : Timestamp{};
+    return true;
+}
+
+bool BookTickerParser::parseWithJson(const std::string& payload, OrderBookUpdate& update) {
+    int64_t updateId = 0;
+    return parseWithJson(payload, update, updateId);
+}
+
+bool BookTickerParser::parseWithJson(const std::string& payload, OrderBookUpdate& update, int64_t& updateId) {
+    auto j = json::parse(payload);
+    if (!j.contains("data")) return false;
+    const auto& data = j["data"];
+
+    update.symbol = data.value("s", "");
+    update.bestBid = std::stod(data.value("b", "0.0"));
+    update.bestAsk = std::stod(data.value("a", "0.0"));
+    update.bestBidQty = std::stod(data.value("B", "0.0"));
+    update.bestAskQty = std::stod(data.value("A", "0.0"));
+    int64_t eventTime = data.value("E", int64_t{0});
+    update.exchangeTime = eventTime ? Timestamp(std::chrono::milliseconds(eventTime)) : Timestamp{};
+    updateId = data.value("u", int64_t{0});
+    return true;
+}
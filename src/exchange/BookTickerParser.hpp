@@ -0,0 +1,36 @@
+#pragma once
+#include "MarketDataTypes.hpp"
+#include <cstdint>
+#include <string_view>
+
+// Fields of one bookTicker frame. `symbol` points into the parsed payload.
+struct BookTicker {
+    std::string_view symbol;
+    double bid = 0.0;
+    double bidQty = 0.0;
+    double ask = 0.0;
+    double askQty = 0.0;
+    int64_t eventTime = 0; // "E" in ms; only USD-M streams send it, spot has none
+    int64_t updateId = 0;  // "u": order book update id, increasing per symbol (0 if absent)
+};
+
+// Parses Binance combined-stream bookTicker frames:
+//   {"stream":"btcusdt@bookTicker","data":{"u":..,"s":"BTCUSDT","b":"..","B":"..","a":"..","A":".."}}
+//
+// parse() scans the payload in place (no DOM, no temporary strings) and is
+// used on the hot path. parseWithJson() is the original nlohmann-based path,
+// kept as a fallback for frames that don't match the expected shape.
+class BookTickerParser {
+public:
+    // Zero-copy variant used for symbol dispatch.
+    static bool parse(std::string_view payload, BookTicker& ticker);
+
+    // Returns false if the payload doesn't match the expected schema.
+    // `update` is only partially written in that case.
+    static bool parse(std::string_view payload, OrderBookUpdate& update);
+
+    // Full JSON parse. Throws on malformed payloads.
+    static bool parseWithJson(const std::string& payload, OrderBookUpdate& update);
+    // Same, also returning "u" (0 if absent) so callers can sequence both paths alike.
+    static bool parseWithJson(const std::string& payload, OrderBookUpdate& update, int64_t& updateId);
+};
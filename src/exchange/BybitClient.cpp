@@ -1,27 +1,50 @@
 #include "BybitClient.hpp"
 #include "MarketDataTypes.hpp"
+#include "TransportManager.hpp"
+#include "FeedJournal.hpp"
+#include "InstrumentRegistry.hpp"
 #include <nlohmann/json.hpp>
 #include <iostream>
 #include <thread>
+#include <algorithm>
 
 using json = nlohmann::json;
 using context_ptr = std::shared_ptr<asio::ssl::context>;
 
-BybitClient::BybitClient(const std::string& symbol) : symbol(symbol), connected(false) {
+BybitClient::BybitClient(const std::string& symbol, int depth)
+    : BybitClient(std::vector<std::string>{symbol}, depth) {}
+
+BybitClient::BybitClient(const std::vector<std::string>& symbols, int depth)
+    : depth(depth), connected(false), sequence(InstrumentRegistry::registerVenue("Bybit"), symbols.size(), [this](int id) { resubscribe(id); }) {
+    for (const auto& s : symbols) symbolTable.add(s);
+    books = std::vector<BookState>(symbolTable.size());
+    for (size_t id = 0; id < books.size(); ++id) {
+        books[id].update.symbol = symbolTable.name(static_cast<int>(id));
+        books[id].update.instrument = InstrumentRegistry::registerInstrument(books[id].update.symbol);
+    }
+
     ws.clear_access_channels(websocketpp::log::alevel::all);
-    ws.init_asio();
 
     ws.set_tls_init_handler([](websocketpp::connection_hdl) -> context_ptr {
         return std::make_shared<asio::ssl::context>(asio::ssl::context::tlsv12_client);
     });
 
     ws.set_message_handler([this](websocketpp::connection_hdl, WebSocketClient::message_ptr msg) {
-        handleIncomingMessage(msg->get_payload());
+        const auto received = ReceiveTime::now();
+        if (journal) journal->append(FeedVenue::Bybit, 0, msg->get_payload(), received);
+        handleIncomingMessage(msg->get_payload(), received);
     });
 }
 
 void BybitClient::connect() {
-    std::string uri = "wss://stream.bybit.com/v5/public/linear";
+    std::string uri = (endpoint.empty() ? "wss://stream.bybit.com" : endpoint) + "/v5/public/linear";
+
+    if (transport) {
+        ws.init_asio(&transport->assign(name()));
+    } else {
+        ws.init_asio();
+    }
+
     websocketpp::lib::error_code ec;
     auto con = ws.get_connection(uri, ec);
     if (ec) {
@@ -29,23 +52,32 @@ void BybitClient::connect() {
         return;
     }
 
-    con->set_open_handler([con](websocketpp::connection_hdl) {
-        std::string subscription = R"({
-            "op": "subscribe",
-            "args": ["orderbook.1.BTCUSDT"]
-        })";
-        con->send(subscription);
-        std::cout << "🔌 Connected to Bybit spot"<<"\n";
+    con->set_open_handler([this, con](websocketpp::connection_hdl) {
+        for (const auto& subscription : subscriptionMessages("subscribe")) {
+            con->send(subscription);
+        }
+        std::cout << "🔌 Connected to Bybit spot (" << symbolTable.size() << " symbols)\n";
+        connected = true;
     });
 
+    conn_hdl = con->get_handle();
     ws.connect(con);
-    std::thread([this]() {
-        ws.run();
-    }).detach();
+
+    if (!transport) {
+        std::thread([this]() {
+            ws.run();
+        }).detach();
+    }
 }
 
 
 void BybitClient::disconnect() {
+    if (transport) {
+        // Stopping the endpoint would stop the shared io_context; close only our connection.
+        websocketpp::lib::error_code ec;
+        ws.close(conn_hdl, websocketpp::close::status::going_away, "Client disconnect", ec);
+        return;
+    }
     ws.stop();
 }
 
@@ -53,37 +85,104 @@ std::string BybitClient::name() const {
     return "Bybit";
 }
 
-void BybitClient::handleIncomingMessage(const std::string& msg) {
+std::string BybitClient::topic(int id) const {
+    return "orderbook." + std::to_string(depth) + "." + symbolTable.name(id);
+}
+
+std::string BybitClient::subscriptionMessage(const std::string& op, size_t first, size_t last) const {
+    json args = json::array();
+    for (size_t id = first; id < last; ++id) args.push_back(topic(static_cast<int>(id)));
+    json msg = {{"op", op}, {"args", args}};
+    return msg.dump();
+}
+
+std::vector<std::string> BybitClient::subscriptionMessages(const std::string& op) const {
+    std::vector<std::string> messages;
+    for (size_t i = 0; i < symbolTable.size(); i += MAX_ARGS_PER_REQUEST) {
+        messages.push_back(subscriptionMessage(op, i, std::min(i + MAX_ARGS_PER_REQUEST, symbolTable.size())));
+    }
+    return messages;
+}
+
+void BybitClient::resetSequences() {
+    for (auto& state : books) state.book.clear();
+    sequence.reset();
+}
+
+void BybitClient::resubscribe(int id) {
+    // Bybit answers a fresh subscription with a new snapshot.
+    books[id].book.clear();
+    if (!connected) return; // replay: the recorded snapshot follows anyway
+
+    websocketpp::lib::error_code ec;
+    ws.send(conn_hdl, subscriptionMessage("unsubscribe", id, id + 1), websocketpp::frame::opcode::text, ec);
+    ws.send(conn_hdl, subscriptionMessage("subscribe", id, id + 1), websocketpp::frame::opcode::text, ec);
+    if (ec) {
+        std::cerr << "❌ Bybit resubscribe error: " << ec.message() << std::endl;
+    }
+}
+
+void BybitClient::applyLevels(OrderBook& book, const json& levels, OrderBook::Side side) {
+    // Bybit level: [price, size]; size "0" deletes the level
+    for (const auto& level : levels) {
+        book.apply(side,
+                   std::stod(level[0].get_ref<const std::string&>()),
+                   std::stod(level[1].get_ref<const std::string&>()));
+    }
+}
+
+void BybitClient::handleIncomingMessage(const std::string& msg, const ReceiveTime& received) {
     // std::cout << "[Bybit Raw] " << msg << std::endl;
 
     try {
-        auto j = json::parse(msg);
-        if (j.contains("data") && j["data"].contains("b") && j["data"].contains("a")) {
-            const auto& bids = j["data"]["b"];
-            const auto& asks = j["data"]["a"];
+        sequence.poll(received.mono);
 
-            if (!bids.empty() && !asks.empty()) {
-                OrderBookUpdate update;
-                update.symbol = "BTCUSDT";
+        auto j = json::parse(msg);
+        if (!j.contains("topic") || !j.contains("data")) return; // op responses, pongs
+
+        const auto& data = j["data"];
+        if (!data.contains("b") || !data.contains("a")) return;
+
+        int id = symbolTable.find(data.value("s", ""));
+        if (id == SymbolTable::NOT_FOUND) return;
+        auto& state = books[id];
+        auto& book = state.book;
+
+        // "u" counts this topic's pushes; "seq" is the cross-topic matching
+        // sequence and may skip, so continuity is checked on u alone.
+        const int64_t updateId = data.value("u", int64_t{0});
+        std::string type = j.value("type", "");
+
+        // u == 1 means Bybit restarted the stream and this delta is really a snapshot
+        if (type == "snapshot" || updateId == 1) {
+            book.clear();
+            sequence.snapshot(id, updateId, received.mono);
+        } else if (!sequence.valid(id)) {
+            return; // waiting for the snapshot after a resync
+        } else if (!sequence.advance(id, updateId - 1, updateId, received.mono)) {
+            std::cerr << "❌ Bybit sequence gap on " << symbolTable.name(id) << " (expected u="
+                      << sequence.last(id) + 1 << ", got " << updateId << "), resyncing book\n";
+            publishWithdrawn(state.update, received);
+            return;
+        }
 
-                // ✅ Prices
-                update.bestBid = std::stod(bids[0][0].get<std::string>());
-                update.bestAsk = std::stod(asks[0][0].get<std::string>());
+        applyLevels(book, data["b"], OrderBook::Side::Bid);
+        applyLevels(book, data["a"], OrderBook::Side::Ask);
 
-                // ✅ Quantities
-                update.bestBidQty = std::stod(bids[0][1].get<std::string>());
-                update.bestAskQty = std::stod(asks[0][1].get<std::string>());
+        if (book.empty()) return;
 
-                update.timestamp = std::chrono::system_clock::now();
+        auto& update = state.update;
+        book.copyTo(update, static_cast<size_t>(depth));
+        update.timestamp = received.wall;
+        update.receiveTime = received.mono;
+        // cts = matching-engine time; ts = when the push was generated
+        int64_t eventTime = j.value("cts", j.value("ts", int64_t{0}));
+        update.exchangeTime = eventTime ? Timestamp(std::chrono::milliseconds(eventTime)) : Timestamp{};
 
-                if (orderBookCallback) {
-                    orderBookCallback(update);
-                }
-            }
+        if (orderBookCallback) {
+            orderBookCallback(update);
         }
     } catch (const std::exception& e) {
         std::cerr << "❌ Bybit parse error: " << e.what() << std::endl;
     }
 }
-
-
@@ -1,24 +1,51 @@
 #pragma once
 #include "ExchangeClient.hpp"
+#include "MarketDataTypes.hpp"
+#include "OrderBook.hpp"
+#include "SequenceTracker.hpp"
+#include "SymbolTable.hpp"
 #include <websocketpp/config/asio_client.hpp>
 #include <websocketpp/client.hpp>
 #include <asio/ssl.hpp>
+#include <nlohmann/json.hpp>
+#include <cstdint>
+#include <vector>
 
 using WebSocketClient = websocketpp::client<websocketpp::config::asio_tls_client>;
 
 class BybitClient : public ExchangeClient {
 public:
-    explicit BybitClient(const std::string& symbol);
+    // depth: Bybit orderbook topic depth (1, 50, 200, 500)
+    explicit BybitClient(const std::string& symbol, int depth = 1);
+    explicit BybitClient(const std::vector<std::string>& symbols, int depth = 1);
 
     void connect() override;
     void disconnect() override;
     std::string name() const override;
+    void handleIncomingMessage(const std::string& msg, const ReceiveTime& received) override;
+    void resetSequences() override;
 
 private:
-    std::string symbol;
+    static constexpr size_t MAX_ARGS_PER_REQUEST = 10; // Bybit rejects larger subscribe requests
+
+    struct BookState {
+        OrderBook book;
+        OrderBookUpdate update; // reused across messages to keep vector capacity
+    };
+
+    int depth;
     bool connected = false;
 
+    SymbolTable symbolTable;       // "BTCUSDT" -> id
+    std::vector<BookState> books;  // id -> book
+    SequenceTracker sequence;      // "u" continuity per id
+
     WebSocketClient ws;
+    websocketpp::connection_hdl conn_hdl;
 
-    void handleIncomingMessage(const std::string& msg);
+    static void applyLevels(OrderBook& book, const nlohmann::json& levels, OrderBook::Side side);
+    std::string topic(int id) const;
+    std::string subscriptionMessage(const std::string& op, size_t first, size_t last) const;
+    std::vector<std::string> subscriptionMessages(const std::string& op) const;
+    void resubscribe(int id);
 };
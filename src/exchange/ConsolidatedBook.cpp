@@ -0,0 +1,100 @@
+#include "ConsolidatedBook.hpp"
+
+void ConsolidatedBook::Side::set(VenueId venue, double price, double qty, bool descending) {
+    erase(venue);
+
+    auto better = [descending](double a, double b) { return descending ? a > b : a < b; };
+
+    // Insertion point after every level at least as good, so earlier quotes keep priority on ties
+    int i = count;
+    while (i > 0 && better(price, levels[i - 1].price)) {
+        levels[i] = levels[i - 1];
+        position[levels[i].venue] = static_cast<int8_t>(i);
+        --i;
+    }
+    levels[i] = {price, qty, venue};
+    position[venue] = static_cast<int8_t>(i);
+    ++count;
+}
+
+void ConsolidatedBook::Side::erase(VenueId venue) {
+    int i = position[venue];
+    if (i < 0) return;
+
+    for (; i + 1 < count; ++i) {
+        levels[i] = levels[i + 1];
+        position[levels[i].venue] = static_cast<int8_t>(i);
+    }
+    position[venue] = -1;
+    --count;
+}
+
+ConsolidatedBook::ConsolidatedBook() : books(InstrumentRegistry::MAX_INSTRUMENTS) {}
+
+void ConsolidatedBook::update(const TopOfBook& top) {
+    if (top.venue < 0 || top.venue >= MAX_VENUES) return;
+    if (top.instrument < 0 || top.instrument >= static_cast<int>(books.size())) return;
+    Book& book = books[top.instrument];
+
+    if (top.bestBid > 0 && top.bestBidQty > 0) book.bids.set(top.venue, top.bestBid, top.bestBidQty, true);
+    else book.bids.erase(top.venue);
+
+    if (top.bestAsk > 0 && top.bestAskQty > 0) book.asks.set(top.venue, top.bestAsk, top.bestAskQty, false);
+    else book.asks.erase(top.venue);
+
+    checkCross(top.instrument, book, top.receiveTime);
+}
+
+void ConsolidatedBook::remove(VenueId venue, InstrumentId instrument) {
+    if (venue < 0 || venue >= MAX_VENUES) return;
+    if (instrument < 0 || instrument >= static_cast<int>(books.size())) return;
+    Book& book = books[instrument];
+
+    book.bids.erase(venue);
+    book.asks.erase(venue);
+    checkCross(instrument, book, MonoTimestamp{});
+}
+
+void ConsolidatedBook::removeVenue(VenueId venue) {
+    for (InstrumentId instrument = 0; instrument < InstrumentRegistry::instrumentCount(); ++instrument) {
+        remove(venue, instrument);
+    }
+}
+
+const ConsolidatedBook::Side& ConsolidatedBook::bids(InstrumentId instrument) const {
+    if (instrument < 0 || instrument >= static_cast<int>(books.size())) return emptySide;
+    return books[instrument].bids;
+}
+
+const ConsolidatedBook::Side& ConsolidatedBook::asks(InstrumentId instrument) const {
+    if (instrument < 0 || instrument >= static_cast<int>(books.size())) return emptySide;
+    return books[instrument].asks;
+}
+
+bool ConsolidatedBook::isCrossed(InstrumentId instrument) const {
+    if (instrument < 0 || instrument >= static_cast<int>(books.size())) return false;
+    return books[instrument].crossed;
+}
+
+void ConsolidatedBook::checkCross(InstrumentId instrument, Book& book, MonoTimestamp receivedAt) {
+    const Level* bid = book.bids.best();
+    const Level* ask = book.asks.best();
+
+    // A venue's own bid at or above its ask is a bad quote, not an opportunity
+    const bool crossed = bid && ask && bid->venue != ask->venue && bid->price >= ask->price;
+    if (!crossed) {
+        book.crossed = false;
+        return;
+    }
+
+    const bool changed = !book.crossed ||
+                         bid->venue != book.lastBid.venue || bid->price != book.lastBid.price ||
+                         ask->venue != book.lastAsk.venue || ask->price != book.lastAsk.price;
+    book.crossed = true;
+    book.lastBid = *bid;
+    book.lastAsk = *ask;
+    if (!changed) return;
+
+    ++events;
+    if (crossListener) crossListener({instrument, *bid, *ask, bid->price == ask->price, receivedAt});
+}
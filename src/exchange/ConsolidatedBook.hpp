@@ -0,0 +1,106 @@
+#pragma once
+#include "MarketDataTypes.hpp"
+#include "InstrumentRegistry.hpp"
+#include "MarketDataAggregator.hpp"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// Consolidated best bid/offer across venues, per canonical instrument.
+//
+// Each side is a small array of venue quotes kept sorted (bids high to
+// low, asks low to high) plus a venue -> position index, so a venue's new
+// quote replaces its old one with a couple of shifts over at most
+// MAX_VENUES entries, and the N best venues of a side are the first N
+// entries.
+//
+// After every update the best bid is compared with the best ask: a
+// consolidated market that is locked (equal) or crossed (bid above ask)
+// on two different venues raises a CrossEvent right away. An event fires
+// when an instrument becomes locked or crossed, and again whenever the
+// venues or prices at the top change while it stays that way.
+//
+// Not thread-safe: updated and read on the dispatcher thread.
+class ConsolidatedBook {
+public:
+    static constexpr int MAX_VENUES = InstrumentRegistry::MAX_VENUES;
+
+    // Dispatcher key raised with every CrossEvent, next to the aggregator's
+    // per-venue keys.
+    static constexpr int CROSS_KEY = MarketDataAggregator::MAX_KEYS;
+
+    struct Level {
+        double price;
+        double qty;
+        VenueId venue;
+    };
+
+    // One side of one instrument, best first.
+    class Side {
+    public:
+        Side() { position.fill(-1); }
+
+        int size() const { return count; }
+        bool empty() const { return count == 0; }
+        const Level& operator[](int i) const { return levels[i]; }
+        const Level* best() const { return count ? &levels[0] : nullptr; }
+
+    private:
+        friend class ConsolidatedBook;
+
+        void set(VenueId venue, double price, double qty, bool descending);
+        void erase(VenueId venue);
+
+        std::array<Level, MAX_VENUES> levels{};
+        std::array<int8_t, MAX_VENUES> position;
+        int count = 0;
+    };
+
+    struct CrossEvent {
+        InstrumentId instrument;
+        Level bid;   // best bid (sell there)
+        Level ask;   // best ask (buy there)
+        bool locked; // bid == ask; otherwise crossed
+        MonoTimestamp receivedAt;
+    };
+
+    using CrossListener = std::function<void(const CrossEvent& event)>;
+    void setCrossListener(CrossListener listener) { crossListener = std::move(listener); }
+
+    ConsolidatedBook();
+
+    // Replaces top.venue's quote for top.instrument. A side with a zero
+    // price or quantity removes that venue from the side.
+    void update(const TopOfBook& top);
+
+    // Drops a venue's quote for an instrument, e.g. when it goes stale.
+    void remove(VenueId venue, InstrumentId instrument);
+    // Same for every instrument, e.g. when the venue's feed stalls.
+    void removeVenue(VenueId venue);
+
+    // Top-N access: bids(i)[0] is the best bid, and so on.
+    const Side& bids(InstrumentId instrument) const;
+    const Side& asks(InstrumentId instrument) const;
+
+    // Whether the instrument is locked or crossed right now.
+    bool isCrossed(InstrumentId instrument) const;
+
+    uint64_t crossEvents() const { return events; }
+
+private:
+    struct Book {
+        Side bids;
+        Side asks;
+        bool crossed = false;
+        Level lastBid{};
+        Level lastAsk{};
+    };
+
+    void checkCross(InstrumentId instrument, Book& book, MonoTimestamp receivedAt);
+
+    std::vector<Book> books; // indexed by InstrumentId
+    Side emptySide;
+    CrossListener crossListener;
+    uint64_t events = 0;
+};
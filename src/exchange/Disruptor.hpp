@@ -0,0 +1,93 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// Building blocks for Disruptor-style multicast rings: one producer per
+// ring, any number of consumers that each track their own position
+// (a Sequence) and read entries in place.
+
+// Last sequence a producer published or a consumer finished with; -1 = none.
+// Padded to its own cache line so cursors of different threads never share one.
+struct alignas(64) Sequence {
+    std::atomic<int64_t> value{-1};
+
+    int64_t load() const { return value.load(std::memory_order_acquire); }
+    void store(int64_t sequence) { value.store(sequence, std::memory_order_release); }
+};
+
+// How a consumer thread waits when it has caught up.
+enum class WaitStrategy {
+    BusySpin, // lowest latency, burns a core
+    Yield,    // spins but gives the core away between checks
+    Block     // sleeps on a condition variable; publishers pay for a notify
+};
+
+// Pre-allocated ring with a single producer. Entries are written in place
+// and stay readable until every gating sequence has moved past them, so
+// consumers read without copying. A producer that would lap the slowest
+// consumer drops the entry instead of waiting: a feed thread must never
+// stall behind a consumer.
+template <typename T>
+class MulticastRing {
+    static_assert(std::is_trivially_copyable_v<T>, "MulticastRing holds plain records");
+
+public:
+    // Capacity is rounded up to a power of two.
+    explicit MulticastRing(size_t minCapacity) {
+        size_t capacity = 1;
+        while (capacity < minCapacity) capacity <<= 1;
+        entries.resize(capacity);
+        mask = capacity - 1;
+    }
+
+    MulticastRing(const MulticastRing&) = delete;
+    MulticastRing& operator=(const MulticastRing&) = delete;
+
+    // Startup only: the producer may not overwrite what `sequence` hasn't consumed.
+    void addGatingSequence(const Sequence& sequence) { gating.push_back(&sequence); }
+
+    // Producer thread only.
+    bool tryPublish(const T& item) {
+        const int64_t next = cursor.value.load(std::memory_order_relaxed) + 1;
+        const int64_t wrapPoint = next - static_cast<int64_t>(entries.size());
+        if (wrapPoint > cachedGating) {
+            cachedGating = minimumGatingSequence(next - 1);
+            if (wrapPoint > cachedGating) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+
+        entries[next & mask] = item;
+        cursor.store(next);
+        return true;
+    }
+
+    // Highest published sequence (-1 = none yet).
+    int64_t published() const { return cursor.load(); }
+
+    // Valid for sequences in (consumer's sequence, published()].
+    const T& get(int64_t sequence) const { return entries[sequence & mask]; }
+
+    size_t capacity() const { return entries.size(); }
+    uint64_t droppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    int64_t minimumGatingSequence(int64_t fallback) const {
+        int64_t minimum = fallback;
+        for (const Sequence* sequence : gating) minimum = std::min(minimum, sequence->load());
+        return minimum;
+    }
+
+    Sequence cursor;
+    int64_t cachedGating = -1; // producer-local
+    std::atomic<uint64_t> dropped{0};
+    std::vector<const Sequence*> gating;
+
+    alignas(64) std::vector<T> entries;
+    size_t mask = 0;
+};
@@ -1,8 +1,10 @@
 #pragma once
+#include "MarketDataTypes.hpp"
 #include <string>
 #include <functional>
 
-struct OrderBookUpdate;  // Forward declare or include from MarketDataTypes
+class TransportManager;
+class FeedJournalWriter;
 
 class ExchangeClient {
 public:
@@ -17,11 +19,67 @@ public:
     // Return name of the exchange
     virtual std::string name() const = 0;
 
+    // Parse one raw frame received at `received`. Called from the socket
+    // handler, and directly by the feed replay tool with recorded times.
+    virtual void handleIncomingMessage(const std::string& msg, const ReceiveTime& received) = 0;
+
+    // Forgets what the client has seen on its streams (sequence ids, local
+    // books), as on a fresh connection. feed_replay calls it before every
+    // pass over a journal.
+    virtual void resetSequences() {}
+
     // Optional: handler setter
     void setOrderBookCallback(std::function<void(const OrderBookUpdate&)> cb) {
         orderBookCallback = cb;
     }
 
+    // Optional: run on a shared event loop instead of a dedicated thread.
+    // Must be called before connect().
+    void useTransport(TransportManager& manager) {
+        transport = &manager;
+    }
+
+    // Optional: connect to another host, e.g. "wss://127.0.0.1:9443" for the
+    // local mock exchange. The client appends its usual venue path.
+    void setEndpoint(const std::string& baseUri) {
+        endpoint = baseUri;
+    }
+
+    // Optional: capture every raw frame before it is parsed (see FeedJournal).
+    void setJournal(FeedJournalWriter* writer) {
+        journal = writer;
+    }
+
 protected:
     std::function<void(const OrderBookUpdate&)> orderBookCallback;
+    TransportManager* transport = nullptr;
+    FeedJournalWriter* journal = nullptr;
+    std::string endpoint; // empty = live venue
+
+    // Publishes `update` with both sides emptied (TopOfBook::withdrawn()),
+    // when the instrument's book is invalidated by a gap or a checksum
+    // mismatch, so nothing downstream keeps trading its last quote while
+    // the resync is pending.
+    void publishWithdrawn(OrderBookUpdate& update, const ReceiveTime& received) {
+        update.bids.clear();
+        update.asks.clear();
+        update.bestBid = update.bestAsk = 0.0;
+        update.bestBidQty = update.bestAskQty = 0.0;
+        update.timestamp = received.wall;
+        update.receiveTime = received.mono;
+        update.exchangeTime = Timestamp{};
+        if (orderBookCallback) orderBookCallback(update);
+    }
+
+    // True when the endpoint override points at this machine (the mock
+    // exchange's self-signed certificate is only accepted there).
+    bool endpointIsLoopback() const {
+        const size_t scheme = endpoint.find("://");
+        const size_t start = scheme == std::string::npos ? 0 : scheme + 3;
+        std::string host = endpoint.substr(start, endpoint.find('/', start) - start);
+        if (host.empty()) return false;
+        host = host.front() == '[' ? host.substr(0, host.find(']') + 1) : host.substr(0, host.find(':'));
+        if (host == "localhost" || host == "[::1]") return true;
+        return host.rfind("127.", 0) == 0 && host.find_first_not_of("0123456789.") == std::string::npos;
+    }
 };
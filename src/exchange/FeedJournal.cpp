@@ -0,0 +1,313 @@
+#include "exchange/FeedJournal.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    constexpr char JOURNAL_MAGIC[8] = {'S', 'P', 'D', 'E', 'J', 'N', 'L', '1'};
+    constexpr uint32_t JOURNAL_VERSION = 1;
+
+    constexpr size_t align8(size_t n) { return (n + 7) & ~size_t{7}; }
+
+    template <typename TimePoint>
+    int64_t toNs(TimePoint t) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+    }
+}
+
+const char* feedVenueName(FeedVenue venue) {
+    switch (venue) {
+        case FeedVenue::Binance: return "Binance";
+        case FeedVenue::OKX: return "OKX";
+        case FeedVenue::Bybit: return "Bybit";
+        case FeedVenue::BinancePerp: return "BinancePerp";
+        default: return "Unknown";
+    }
+}
+
+FeedVenue feedVenueFromName(const std::string& name) {
+    if (name == "Binance") return FeedVenue::Binance;
+    if (name == "OKX") return FeedVenue::OKX;
+    if (name == "Bybit") return FeedVenue::Bybit;
+    if (name == "BinancePerp") return FeedVenue::BinancePerp;
+    return FeedVenue::Unknown;
+}
+
+// ---------------------------------------------------------------------------
+// MappedFile
+// ---------------------------------------------------------------------------
+
+MappedFile::~MappedFile() {
+    close(length);
+}
+
+#ifdef _WIN32
+
+bool MappedFile::openForWrite(const std::string& path, size_t size) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                              CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER li;
+    li.QuadPart = static_cast<LONGLONG>(size);
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, li.HighPart, li.LowPart, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, size);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    fileHandle = file;
+    mappingHandle = mapping;
+    base = static_cast<char*>(view);
+    length = size;
+    writable = true;
+    return true;
+}
+
+bool MappedFile::openForRead(const std::string& path) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    fileHandle = file;
+    mappingHandle = mapping;
+    base = static_cast<char*>(view);
+    length = static_cast<size_t>(fileSize.QuadPart);
+    writable = false;
+    return true;
+}
+
+void MappedFile::close(size_t finalSize) {
+    if (!base) return;
+
+    if (writable) FlushViewOfFile(base, 0);
+    UnmapViewOfFile(base);
+    CloseHandle(static_cast<HANDLE>(mappingHandle));
+
+    if (writable) {
+        LARGE_INTEGER li;
+        li.QuadPart = static_cast<LONGLONG>(finalSize);
+        SetFilePointerEx(static_cast<HANDLE>(fileHandle), li, nullptr, FILE_BEGIN);
+        SetEndOfFile(static_cast<HANDLE>(fileHandle));
+    }
+    CloseHandle(static_cast<HANDLE>(fileHandle));
+
+    base = nullptr;
+    length = 0;
+    fileHandle = nullptr;
+    mappingHandle = nullptr;
+}
+
+#else
+
+bool MappedFile::openForWrite(const std::string& path, size_t size) {
+    int handle = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (handle < 0) return false;
+
+    if (::ftruncate(handle, static_cast<off_t>(size)) != 0) {
+        ::close(handle);
+        return false;
+    }
+
+    void* view = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, handle, 0);
+    if (view == MAP_FAILED) {
+        ::close(handle);
+        return false;
+    }
+
+    fd = handle;
+    base = static_cast<char*>(view);
+    length = size;
+    writable = true;
+    return true;
+}
+
+bool MappedFile::openForRead(const std::string& path) {
+    int handle = ::open(path.c_str(), O_RDONLY);
+    if (handle < 0) return false;
+
+    struct stat st;
+    if (::fstat(handle, &st) != 0 || st.st_size == 0) {
+        ::close(handle);
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(st.st_size);
+    void* view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, handle, 0);
+    if (view == MAP_FAILED) {
+        ::close(handle);
+        return false;
+    }
+
+    fd = handle;
+    base = static_cast<char*>(view);
+    length = size;
+    writable = false;
+    return true;
+}
+
+void MappedFile::close(size_t finalSize) {
+    if (!base) return;
+
+    if (writable) ::msync(base, length, MS_SYNC);
+    ::munmap(base, length);
+
+    if (writable && ::ftruncate(fd, static_cast<off_t>(finalSize)) != 0) {
+        std::cerr << "❌ Failed to truncate journal file\n";
+    }
+    ::close(fd);
+
+    base = nullptr;
+    length = 0;
+    fd = -1;
+}
+
+#endif
+
+// ---------------------------------------------------------------------------
+// FeedJournalWriter
+// ---------------------------------------------------------------------------
+
+FeedJournalWriter::FeedJournalWriter(const std::string& path, size_t capacityBytes) : path(path) {
+    capacityBytes = std::max(capacityBytes, sizeof(FeedJournalFileHeader) + 4096);
+
+    if (!file.openForWrite(path, capacityBytes)) {
+        std::cerr << "❌ Failed to create feed journal: " << path << std::endl;
+        return;
+    }
+
+    FeedJournalFileHeader header{};
+    std::memcpy(header.magic, JOURNAL_MAGIC, sizeof(header.magic));
+    header.version = JOURNAL_VERSION;
+    header.headerSize = sizeof(FeedJournalFileHeader);
+    std::memcpy(file.data(), &header, sizeof(header));
+
+    writeOffset.store(align8(sizeof(FeedJournalFileHeader)), std::memory_order_relaxed);
+    std::cout << "📼 Recording feed to " << path << " (" << (capacityBytes >> 20) << " MiB)\n";
+}
+
+FeedJournalWriter::~FeedJournalWriter() {
+    close();
+}
+
+void FeedJournalWriter::append(FeedVenue venue, uint16_t streamId, std::string_view payload, const ReceiveTime& received) {
+    append(venue, streamId, payload, toNs(received.wall), toNs(received.mono));
+}
+
+void FeedJournalWriter::append(FeedVenue venue, uint16_t streamId, std::string_view payload,
+                               int64_t recvWallNs, int64_t recvMonoNs) {
+    char* base = file.data();
+    if (!base || payload.empty()) return;
+
+    const size_t recordSize = align8(sizeof(FeedRecordHeader) + payload.size());
+    const uint64_t offset = writeOffset.fetch_add(recordSize, std::memory_order_relaxed);
+
+    // Keep at least one zeroed header after the last record as terminator.
+    if (offset + recordSize + sizeof(FeedRecordHeader) > file.size()) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    auto* header = reinterpret_cast<FeedRecordHeader*>(base + offset);
+    header->venue = static_cast<uint16_t>(venue);
+    header->streamId = streamId;
+    header->recvWallNs = recvWallNs;
+    header->recvMonoNs = recvMonoNs;
+    std::memcpy(base + offset + sizeof(FeedRecordHeader), payload.data(), payload.size());
+
+    // Publish: readers stop at the first record with length 0.
+    std::atomic_ref<uint32_t>(header->length).store(static_cast<uint32_t>(payload.size()), std::memory_order_release);
+    records.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FeedJournalWriter::close() {
+    if (!file.data()) return;
+
+    size_t used = std::min<uint64_t>(writeOffset.load(std::memory_order_acquire), file.size());
+    file.close(used);
+    printStats();
+}
+
+void FeedJournalWriter::printStats() const {
+    std::cout << "📼 Feed journal " << path << ": "
+              << recordsWritten() << " frames recorded, "
+              << droppedFrames() << " dropped\n";
+}
+
+// ---------------------------------------------------------------------------
+// FeedJournalReader
+// ---------------------------------------------------------------------------
+
+FeedJournalReader::FeedJournalReader(const std::string& path) {
+    if (!file.openForRead(path) || file.size() < sizeof(FeedJournalFileHeader)) {
+        std::cerr << "❌ Failed to open feed journal: " << path << std::endl;
+        return;
+    }
+
+    FeedJournalFileHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, JOURNAL_MAGIC, sizeof(header.magic)) != 0 || header.version != JOURNAL_VERSION) {
+        std::cerr << "❌ Not a feed journal (bad magic/version): " << path << std::endl;
+        return;
+    }
+
+    valid = true;
+    rewind();
+}
+
+void FeedJournalReader::rewind() {
+    offset = align8(sizeof(FeedJournalFileHeader));
+}
+
+bool FeedJournalReader::next(FeedRecord& record) {
+    if (!valid || offset + sizeof(FeedRecordHeader) > file.size()) return false;
+
+    FeedRecordHeader header;
+    std::memcpy(&header, file.data() + offset, sizeof(header));
+    if (header.length == 0 || offset + sizeof(FeedRecordHeader) + header.length > file.size()) return false;
+
+    record.venue = static_cast<FeedVenue>(header.venue);
+    record.streamId = header.streamId;
+    record.recvWallNs = header.recvWallNs;
+    record.recvMonoNs = header.recvMonoNs;
+    record.payload = std::string_view(file.data() + offset + sizeof(FeedRecordHeader), header.length);
+
+    offset += align8(sizeof(FeedRecordHeader) + header.length);
+    return true;
+}
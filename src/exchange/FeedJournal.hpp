@@ -0,0 +1,129 @@
+#pragma once
+#include "MarketDataTypes.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Venue ids stored in the journal. Values are part of the file format.
+enum class FeedVenue : uint16_t {
+    Unknown = 0,
+    Binance = 1,
+    OKX = 2,
+    Bybit = 3,
+    BinancePerp = 4,
+};
+
+const char* feedVenueName(FeedVenue venue);
+FeedVenue feedVenueFromName(const std::string& name);
+
+// On-disk layout (little endian, 8-byte aligned records):
+//
+//   FeedJournalFileHeader
+//   { FeedRecordHeader, payload bytes, padding to 8 } ...
+//
+// A record whose `length` is 0 marks the end of the journal: writers
+// reserve space first and publish `length` last, so a crash mid-write
+// never exposes a torn record.
+struct FeedJournalFileHeader {
+    char magic[8];        // "SPDEJNL1"
+    uint32_t version;
+    uint32_t headerSize;
+    uint64_t reserved[2];
+};
+
+struct FeedRecordHeader {
+    uint32_t length;      // payload bytes, committed last
+    uint16_t venue;       // FeedVenue
+    uint16_t streamId;    // per-venue connection/stream index
+    int64_t recvWallNs;   // system_clock, ns since epoch
+    int64_t recvMonoNs;   // steady_clock, ns
+};
+
+struct FeedRecord {
+    FeedVenue venue;
+    uint16_t streamId;
+    int64_t recvWallNs;
+    int64_t recvMonoNs;
+    std::string_view payload; // points into the mapped file
+};
+
+// Platform file mapping (CreateFileMapping / mmap).
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool openForWrite(const std::string& path, size_t size);
+    bool openForRead(const std::string& path);
+    // Unmaps; for writable files, truncates to `finalSize` first.
+    void close(size_t finalSize = 0);
+
+    char* data() const { return base; }
+    size_t size() const { return length; }
+
+private:
+    char* base = nullptr;
+    size_t length = 0;
+    bool writable = false;
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#else
+    int fd = -1;
+#endif
+};
+
+// Append-only capture of raw websocket frames. append() is lock-free and
+// safe to call from every feed thread at once: space is reserved with one
+// atomic fetch_add and the frame is memcpy'd into the mapping. When the
+// preallocated capacity runs out, frames are counted as dropped.
+class FeedJournalWriter {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = size_t{1} << 30; // 1 GiB
+
+    explicit FeedJournalWriter(const std::string& path, size_t capacityBytes = DEFAULT_CAPACITY);
+    ~FeedJournalWriter();
+
+    FeedJournalWriter(const FeedJournalWriter&) = delete;
+    FeedJournalWriter& operator=(const FeedJournalWriter&) = delete;
+
+    bool isOpen() const { return file.data() != nullptr; }
+
+    void append(FeedVenue venue, uint16_t streamId, std::string_view payload, const ReceiveTime& received);
+    void append(FeedVenue venue, uint16_t streamId, std::string_view payload, int64_t recvWallNs, int64_t recvMonoNs);
+
+    // Truncates the file to the bytes actually used.
+    void close();
+
+    uint64_t recordsWritten() const { return records.load(std::memory_order_relaxed); }
+    uint64_t droppedFrames() const { return dropped.load(std::memory_order_relaxed); }
+    void printStats() const;
+
+private:
+    std::string path;
+    MappedFile file;
+    std::atomic<uint64_t> writeOffset{0};
+    std::atomic<uint64_t> records{0};
+    std::atomic<uint64_t> dropped{0};
+};
+
+// Sequential reader over a captured journal.
+class FeedJournalReader {
+public:
+    explicit FeedJournalReader(const std::string& path);
+
+    bool isOpen() const { return valid; }
+
+    // Returns false at the end of the journal.
+    bool next(FeedRecord& record);
+    void rewind();
+
+private:
+    MappedFile file;
+    size_t offset = 0;
+    bool valid = false;
+};
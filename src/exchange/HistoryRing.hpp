@@ -0,0 +1,49 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Fixed-capacity history of the last capacity() values, oldest first.
+//
+// Every value is stored twice, at i and i + capacity, so any window of the
+// most recent values is one contiguous span no matter where the ring
+// wrapped. Readers get it without copying and can run plain loops (which
+// the compiler vectorizes) over it. Single-threaded.
+template <typename T>
+class HistoryRing {
+public:
+    // Capacity is rounded up to a power of two.
+    explicit HistoryRing(size_t minCapacity) {
+        size_t capacity = 1;
+        while (capacity < minCapacity) capacity <<= 1;
+        values.resize(2 * capacity);
+        mask = capacity - 1;
+    }
+
+    void push(const T& value) {
+        const size_t i = static_cast<size_t>(count) & mask;
+        values[i] = value;
+        values[i + mask + 1] = value;
+        ++count;
+    }
+
+    // The last n values (fewer if not that many yet), oldest first.
+    std::span<const T> last(size_t n) const {
+        n = std::min(n, size());
+        return {values.data() + (static_cast<size_t>(count - n) & mask), n};
+    }
+
+    std::span<const T> all() const { return last(size()); }
+
+    size_t size() const { return static_cast<size_t>(std::min<uint64_t>(count, mask + 1)); }
+    size_t capacity() const { return mask + 1; }
+    uint64_t total() const { return count; } // values ever pushed
+    bool empty() const { return count == 0; }
+
+private:
+    std::vector<T> values;
+    size_t mask = 0;
+    uint64_t count = 0;
+};
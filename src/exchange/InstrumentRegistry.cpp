@@ -0,0 +1,91 @@
+#include "InstrumentRegistry.hpp"
+#include <cctype>
+#include <iostream>
+
+SymbolTable InstrumentRegistry::venues;
+SymbolTable InstrumentRegistry::instruments;
+SymbolTable InstrumentRegistry::spellings;
+std::vector<InstrumentId> InstrumentRegistry::spellingInstrument;
+SymbolTable InstrumentRegistry::series;
+
+namespace {
+    // Longest first, so "FDUSD" wins over "USD"
+    const char* const QUOTE_CURRENCIES[] = {"FDUSD", "USDT", "USDC", "BUSD", "USD", "EUR", "BTC", "ETH"};
+
+    bool isSeparator(char c) {
+        return c == '-' || c == '_' || c == '/' || c == ':';
+    }
+}
+
+std::string InstrumentRegistry::canonicalSymbol(std::string_view venueSymbol) {
+    std::string base, quote;
+    bool split = false;
+    for (char c : venueSymbol) {
+        if (isSeparator(c)) {
+            if (split) break; // "BTC-USDT-SWAP": keep base and quote only
+            split = true;
+            continue;
+        }
+        (split ? quote : base).push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
+    }
+
+    if (split && !base.empty() && !quote.empty()) return base + "/" + quote;
+
+    for (const char* q : QUOTE_CURRENCIES) {
+        std::string_view suffix(q);
+        if (base.size() > suffix.size() && std::string_view(base).substr(base.size() - suffix.size()) == suffix) {
+            return base.substr(0, base.size() - suffix.size()) + "/" + std::string(suffix);
+        }
+    }
+    return base;
+}
+
+VenueId InstrumentRegistry::registerVenue(const std::string& name) {
+    VenueId id = venues.find(name);
+    if (id != NOT_FOUND) return id;
+
+    if (venueCount() >= MAX_VENUES) {
+        std::cerr << "❌ InstrumentRegistry: too many venues, ignoring " << name << std::endl;
+        return NOT_FOUND;
+    }
+    return venues.add(name);
+}
+
+InstrumentId InstrumentRegistry::registerInstrument(std::string_view venueSymbol) {
+    InstrumentId id = instrumentId(venueSymbol);
+    if (id != NOT_FOUND) return id;
+
+    std::string canonical = canonicalSymbol(venueSymbol);
+    id = instruments.find(canonical);
+    if (id == NOT_FOUND) {
+        if (instrumentCount() >= MAX_INSTRUMENTS) {
+            std::cerr << "❌ InstrumentRegistry: too many instruments, ignoring " << venueSymbol << std::endl;
+            return NOT_FOUND;
+        }
+        id = instruments.add(canonical);
+    }
+
+    // Remember the raw spelling so later lookups skip normalization
+    if (spellings.add(venueSymbol) == static_cast<int>(spellingInstrument.size())) {
+        spellingInstrument.push_back(id);
+    }
+    return id;
+}
+
+int InstrumentRegistry::registerSeries(const std::string& name) {
+    return series.add(name);
+}
+
+VenueId InstrumentRegistry::venueId(std::string_view name) {
+    return venues.find(name);
+}
+
+InstrumentId InstrumentRegistry::instrumentId(std::string_view venueSymbol) {
+    int spelling = spellings.find(venueSymbol);
+    if (spelling != NOT_FOUND) return spellingInstrument[spelling];
+    return instruments.find(canonicalSymbol(venueSymbol));
+}
+
+int InstrumentRegistry::seriesId(std::string_view name) {
+    return series.find(name);
+}
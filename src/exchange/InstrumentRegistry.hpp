@@ -0,0 +1,54 @@
+#pragma once
+#include "MarketDataTypes.hpp"
+#include "SymbolTable.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Central name -> id registry for everything the engine keys by name:
+// venues ("Binance"), instruments ("BTC/USDT") and named series used by
+// the statistical engines ("BTC_SPOT_SYNTH").
+//
+// Venue-specific spellings ("BTCUSDT", "BTC-USDT", "btcusdt") normalize to
+// one canonical instrument, so the same market gets the same id on every
+// venue. Ids are dense and small, so per-venue/per-instrument state can
+// live in plain arrays indexed by id instead of string-keyed maps.
+//
+// Registration happens at startup, before any feed thread runs (clients
+// register their symbols in their constructors). After that the registry
+// is read-only and lookups are safe from any thread.
+class InstrumentRegistry {
+public:
+    static constexpr int NOT_FOUND = SymbolTable::NOT_FOUND;
+    static constexpr int MAX_VENUES = 8;
+    static constexpr int MAX_INSTRUMENTS = 4096;
+
+    // Return the existing id if already registered; NOT_FOUND when full.
+    static VenueId registerVenue(const std::string& name);
+    static InstrumentId registerInstrument(std::string_view venueSymbol);
+    static int registerSeries(const std::string& name);
+
+    static VenueId venueId(std::string_view name);
+    static InstrumentId instrumentId(std::string_view venueSymbol); // any spelling
+    static int seriesId(std::string_view name);
+
+    static const std::string& venueName(VenueId id) { return venues.name(id); }
+    static const std::string& instrumentName(InstrumentId id) { return instruments.name(id); }
+    static const std::string& seriesName(int id) { return series.name(id); }
+
+    static int venueCount() { return static_cast<int>(venues.size()); }
+    static int instrumentCount() { return static_cast<int>(instruments.size()); }
+    static int seriesCount() { return static_cast<int>(series.size()); }
+
+    // "btc-usdt", "BTC_USDT", "BTCUSDT" -> "BTC/USDT". Symbols without a
+    // separator are split on a known quote currency suffix; anything else
+    // is returned uppercased.
+    static std::string canonicalSymbol(std::string_view venueSymbol);
+
+private:
+    static SymbolTable venues;
+    static SymbolTable instruments;  // canonical names
+    static SymbolTable spellings;    // raw venue spellings seen so far
+    static std::vector<InstrumentId> spellingInstrument;
+    static SymbolTable series;
+};
@@ -0,0 +1,77 @@
+#pragma once
+#include <charconv>
+#include <cstdint>
+#include <string_view>
+
+// Minimal in-place JSON scanning helpers for the fixed-schema fast-path
+// parsers (bookTicker, markPrice@arr, ...). They never allocate; anything
+// outside the simple flat shapes we expect makes them return false so the
+// caller can fall back to nlohmann::json.
+namespace JsonScan {
+
+    inline const char* skipWhitespace(const char* p, const char* end) {
+        while (p < end && (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t')) ++p;
+        return p;
+    }
+
+    // Reads a JSON string starting at the opening quote. Escaped strings are
+    // rejected so the caller falls back to the full parser.
+    inline bool readString(const char*& p, const char* end, std::string_view& out) {
+        if (p >= end || *p != '"') return false;
+        const char* start = ++p;
+        while (p < end && *p != '"') {
+            if (*p == '\\') return false;
+            ++p;
+        }
+        if (p >= end) return false;
+        out = std::string_view(start, p - start);
+        ++p; // closing quote
+        return true;
+    }
+
+    // Reads a scalar value (string, number, true/false/null). Nested objects
+    // and arrays are rejected.
+    inline bool readScalar(const char*& p, const char* end, std::string_view& out) {
+        if (p >= end) return false;
+        if (*p == '"') return readString(p, end, out);
+        if (*p == '{' || *p == '[') return false;
+
+        const char* start = p;
+        while (p < end && *p != ',' && *p != '}' && *p != ']' && *p != ' ' && *p != '\n' && *p != '\r' && *p != '\t') ++p;
+        out = std::string_view(start, p - start);
+        return !out.empty();
+    }
+
+    // Reads `"key":` and leaves p on the value.
+    inline bool readKey(const char*& p, const char* end, std::string_view& key) {
+        if (!readString(p, end, key)) return false;
+        p = skipWhitespace(p, end);
+        if (p >= end || *p != ':') return false;
+        p = skipWhitespace(p + 1, end);
+        return true;
+    }
+
+    // After a value: consumes a ',' (returns true, more members follow) or
+    // stops on the closing `close` character (returns true, *p == close).
+    inline bool nextMember(const char*& p, const char* end, char close) {
+        p = skipWhitespace(p, end);
+        if (p >= end) return false;
+        if (*p == ',') {
+            p = skipWhitespace(p + 1, end);
+            return true;
+        }
+        return *p == close;
+    }
+
+    inline bool toDouble(std::string_view text, double& out) {
+        const char* last = text.data() + text.size();
+        auto [ptr, ec] = std::from_chars(text.data(), last, out);
+        return ec == std::errc() && ptr == last;
+    }
+
+    inline bool toInt64(std::string_view text, int64_t& out) {
+        const char* last = text.data() + text.size();
+        auto [ptr, ec] = std::from_chars(text.data(), last, out);
+        return ec == std::errc() && ptr == last;
+    }
+}
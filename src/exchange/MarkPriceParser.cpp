@@ -0,0 +1,84 @@
+#include "exchange/MarkPriceParser.hpp"
+#include "exchange/JsonScan.hpp"
+#include <cstring>
+
+using namespace JsonScan;
+
+namespace {
+    struct MarkPriceFields {
+        std::string_view mark, index, funding, nextFunding, eventTime;
+    };
+
+    bool convert(const MarkPriceFields& f, MarkPriceEntry& entry) {
+        return toDouble(f.mark, entry.markPrice) &&
+               toDouble(f.index, entry.indexPrice) &&
+               toDouble(f.funding, entry.fundingRate) &&
+               toInt64(f.nextFunding, entry.nextFundingTime) &&
+               toInt64(f.eventTime, entry.eventTime);
+    }
+}
+
+bool MarkPriceParser::parse(std::string_view payload, const SymbolTable& watched, std::vector<MarkPriceEntry>& out) {
+    out.clear();
+
+    const char* p = payload.data();
+    const char* end = p + payload.size();
+
+    p = skipWhitespace(p, end);
+    if (p >= end || *p != '[') return false;
+    p = skipWhitespace(p + 1, end);
+
+    while (p < end && *p != ']') {
+        if (*p != '{') return false;
+        p = skipWhitespace(p + 1, end);
+
+        MarkPriceFields fields;
+        int symbolId = SymbolTable::NOT_FOUND;
+        bool skipped = false;
+
+        while (p < end && *p != '}') {
+            std::string_view key, value;
+            if (!readKey(p, end, key)) return false;
+            if (!readScalar(p, end, value)) return false;
+
+            if (key == "s") {
+                symbolId = watched.find(value);
+                if (symbolId == SymbolTable::NOT_FOUND) {
+                    // Entries are flat and symbols/prices never contain '}',
+                    // so jump straight to the end of this object.
+                    const void* close = std::memchr(p, '}', static_cast<size_t>(end - p));
+                    if (!close) return false;
+                    p = static_cast<const char*>(close);
+                    skipped = true;
+                    break;
+                }
+            } else if (key == "p") {
+                fields.mark = value;
+            } else if (key == "i") {
+                fields.index = value;
+            } else if (key == "r") {
+                fields.funding = value;
+            } else if (key == "T") {
+                fields.nextFunding = value;
+            } else if (key == "E") {
+                fields.eventTime = value;
+            }
+
+            if (!nextMember(p, end, '}')) return false;
+        }
+
+        if (p >= end) return false;
+        ++p; // '}'
+
+        if (!skipped && symbolId != SymbolTable::NOT_FOUND) {
+            MarkPriceEntry entry;
+            entry.symbolId = symbolId;
+            if (!convert(fields, entry)) return false;
+            out.push_back(entry);
+        }
+
+        if (!nextMember(p, end, ']')) return false;
+    }
+
+    return p < end;
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include "SymbolTable.hpp"
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// One watched symbol from a Binance futures markPriceUpdate event.
+struct MarkPriceEntry {
+    int symbolId = SymbolTable::NOT_FOUND;
+    double markPrice = 0.0;    // "p"
+    double indexPrice = 0.0;   // "i"
+    double fundingRate = 0.0;  // "r"
+    int64_t nextFundingTime = 0; // "T", ms since epoch
+    int64_t eventTime = 0;       // "E", ms since epoch
+};
+
+// Single-pass scanner for the all-market !markPrice@arr payload:
+//   [{"e":"markPriceUpdate","E":..,"s":"BTCUSDT","p":"..","ap":"..","P":"..","i":"..","r":"..","T":..}, ...]
+//
+// Each entry's symbol is looked up in a precomputed SymbolTable; entries
+// for unwatched symbols are skipped without converting any numbers.
+class MarkPriceParser {
+public:
+    // Appends one entry per watched symbol to `out` (cleared first).
+    // Returns false if the payload doesn't match the expected schema.
+    static bool parse(std::string_view payload, const SymbolTable& watched, std::vector<MarkPriceEntry>& out);
+};
@@ -1,61 +1,222 @@
 #include "MarketDataAggregator.hpp"
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
+#include <cstring>
 
-void MarketDataAggregator::update(const std::string& exchange, const OrderBookUpdate& update) {
-    std::lock_guard<std::mutex> lock(dataMutex);
-    exchangeData[exchange] = update;
+void BookSnapshot::assign(const OrderBookUpdate& update) {
+    size_t len = std::min(update.symbol.size(), MAX_SYMBOL);
+    std::memcpy(symbol, update.symbol.data(), len);
+    symbol[len] = '\0';
+    instrument = update.instrument;
+
+    bestBid = update.bestBid;
+    bestAsk = update.bestAsk;
+    bestBidQty = update.bestBidQty;
+    bestAskQty = update.bestAskQty;
+    bidQty = update.bidQty;
+    askQty = update.askQty;
+    timestamp = update.timestamp;
+    receiveTime = update.receiveTime;
+    exchangeTime = update.exchangeTime;
+
+    bidDepth = static_cast<uint32_t>(std::min(update.bids.size(), MAX_DEPTH));
+    askDepth = static_cast<uint32_t>(std::min(update.asks.size(), MAX_DEPTH));
+    for (uint32_t i = 0; i < bidDepth; ++i) bids[i] = {update.bids[i].first, update.bids[i].second};
+    for (uint32_t i = 0; i < askDepth; ++i) asks[i] = {update.asks[i].first, update.asks[i].second};
 }
 
-void MarketDataAggregator::printSnapshot() {
-    std::lock_guard<std::mutex> lock(dataMutex);
+void BookSnapshot::copyTo(OrderBookUpdate& update) const {
+    update.symbol.assign(symbol);
+    update.instrument = instrument;
+    update.bestBid = bestBid;
+    update.bestAsk = bestAsk;
+    update.bestBidQty = bestBidQty;
+    update.bestAskQty = bestAskQty;
+    update.bidQty = bidQty;
+    update.askQty = askQty;
+    update.timestamp = timestamp;
+    update.receiveTime = receiveTime;
+    update.exchangeTime = exchangeTime;
 
-    std::cout << "\n=== Market Snapshot ===\n";
-    for (const auto& [exchange, update] : exchangeData) {
-        std::cout << exchange << "  - " << update.symbol 
-                  << " | Bid: " << update.bestBid 
-                  << " | Ask: " << update.bestAsk << "\n";
+    update.bids.resize(bidDepth);
+    update.asks.resize(askDepth);
+    for (uint32_t i = 0; i < bidDepth; ++i) update.bids[i] = {bids[i].price, bids[i].qty};
+    for (uint32_t i = 0; i < askDepth; ++i) update.asks[i] = {asks[i].price, asks[i].qty};
+}
 
-        auto it = fundingInfo.find(exchange);
-        if (it != fundingInfo.end()) {
-            std::cout << std::fixed << std::setprecision(10);
-            std::cout << "   ↳ Mark: " << it->second.markPrice 
-                      << ", Funding: " << it->second.fundingRate << "\n";
-        }
+MarketSnapshot::MarketSnapshot()
+    : entries(MarketDataAggregator::MAX_VENUES * MarketDataAggregator::MAX_INSTRUMENTS),
+      blockVersions(MarketDataAggregator::MAX_VENUES * MarketDataAggregator::BLOCKS, 0) {}
+
+const MarketSnapshot::Entry* MarketSnapshot::entry(VenueId venue, InstrumentId instrument) const {
+    if (venue < 0 || venue >= MarketDataAggregator::MAX_VENUES) return nullptr;
+    if (instrument < 0 || instrument >= MarketDataAggregator::MAX_INSTRUMENTS) return nullptr;
+    return &entries[venue * MarketDataAggregator::MAX_INSTRUMENTS + instrument];
+}
+
+const TopOfBook* MarketSnapshot::quote(VenueId venue, InstrumentId instrument) const {
+    const Entry* e = entry(venue, instrument);
+    return e && e->quoteVersion ? &e->top : nullptr;
+}
+
+const FundingData* MarketSnapshot::funding(VenueId venue, InstrumentId instrument) const {
+    const Entry* e = entry(venue, instrument);
+    return e && e->fundingVersion ? &e->funding : nullptr;
+}
+
+MarketDataAggregator::MarketDataAggregator() {
+    for (auto& shard : shards) {
+        shard.slots = std::make_unique<Slot[]>(MAX_INSTRUMENTS);
+        shard.blockVersions = std::make_unique<std::atomic<uint64_t>[]>(BLOCKS);
+        for (int b = 0; b < BLOCKS; ++b) shard.blockVersions[b].store(0, std::memory_order_relaxed);
+        shard.books.resize(MAX_INSTRUMENTS);
     }
+}
+
+int MarketDataAggregator::keyFor(const std::string& name) {
+    const std::string suffix = ":funding";
+    bool funding = name.size() > suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
 
-    std::cout << "\n=== Synthetic Instruments ===\n";
-    for (const auto& [name, syn] : syntheticData) {
-        std::cout << "🔹 " << syn.type << " [" << name << "] - Price: " << syn.price 
-                  << " (LegA: " << syn.legA << ", LegB: " << syn.legB << ")\n";
+    VenueId venue = InstrumentRegistry::registerVenue(funding ? name.substr(0, name.size() - suffix.size()) : name);
+    if (venue == InstrumentRegistry::NOT_FOUND) return -1;
+    return funding ? fundingKey(venue) : quoteKey(venue);
+}
+
+void MarketDataAggregator::enableDepth(InstrumentId instrument) {
+    if (instrument < 0 || instrument >= MAX_INSTRUMENTS) return;
+    for (auto& shard : shards) {
+        if (!shard.books[instrument]) shard.books[instrument] = std::make_unique<SeqLock<BookSnapshot>>();
     }
 }
 
+bool MarketDataAggregator::inRange(VenueId venue, InstrumentId instrument) {
+    return venue >= 0 && venue < MAX_VENUES && instrument >= 0 && instrument < MAX_INSTRUMENTS;
+}
 
+void MarketDataAggregator::markChanged(Shard& shard, InstrumentId instrument) {
+    // Every stamp is unique, so a reader that saw an older one always
+    // notices, even when two writers of the same venue race here
+    const uint64_t stamp = shard.writes.fetch_add(1, std::memory_order_acq_rel) + 1;
+    shard.blockVersions[instrument / BLOCK].store(stamp, std::memory_order_release);
+}
 
-const std::unordered_map<std::string, OrderBookUpdate>& MarketDataAggregator::getLatestUpdates() const {
-    return exchangeData;
+void MarketDataAggregator::update(VenueId venue, const OrderBookUpdate& update) {
+    updateBook(venue, update);
+    this->update(TopOfBook::from(venue, update));
 }
-void MarketDataAggregator::updateFundingAndMark(const std::string& exchange, double mark, double funding) {
-    std::lock_guard<std::mutex> lock(dataMutex);
-    fundingInfo[exchange] = {mark, funding};
+
+void MarketDataAggregator::update(const TopOfBook& top) {
+    if (!inRange(top.venue, top.instrument)) return;
+
+    shards[top.venue].slots[top.instrument].quote.store(top);
+    markChanged(shards[top.venue], top.instrument);
+
+    if (updateListener) updateListener(quoteKey(top.venue), top.instrument, top.receiveTime);
 }
 
-std::optional<FundingData> MarketDataAggregator::getFundingData(const std::string& exchange) const {
-    std::lock_guard<std::mutex> lock(dataMutex);
-    auto it = fundingInfo.find(exchange);
-    if (it != fundingInfo.end()) {
-        return it->second;
+void MarketDataAggregator::updateBook(VenueId venue, const OrderBookUpdate& update) {
+    if (!inRange(venue, update.instrument)) return;
+    auto& book = shards[venue].books[update.instrument];
+    if (!book) return;
+
+    // Built in writer-local storage, then published in one SeqLock write
+    thread_local BookSnapshot snapshot;
+    snapshot.assign(update);
+    book->store(snapshot);
+}
+
+void MarketDataAggregator::updateFunding(VenueId venue, InstrumentId instrument, const FundingData& funding) {
+    if (!inRange(venue, instrument)) return;
+
+    shards[venue].slots[instrument].funding.store(funding);
+    markChanged(shards[venue], instrument);
+
+    if (updateListener) updateListener(fundingKey(venue), instrument, MonoTimestamp{});
+}
+
+bool MarketDataAggregator::getLatest(VenueId venue, InstrumentId instrument, TopOfBook& out) const {
+    if (!inRange(venue, instrument)) return false;
+    const Slot& slot = shards[venue].slots[instrument];
+    if (slot.quote.version() == 0) return false;
+
+    out = slot.quote.load();
+    return true;
+}
+
+bool MarketDataAggregator::getBook(VenueId venue, InstrumentId instrument, OrderBookUpdate& out) const {
+    if (!inRange(venue, instrument)) return false;
+    const auto& book = shards[venue].books[instrument];
+    if (!book || book->version() == 0) return false;
+
+    thread_local BookSnapshot snapshot;
+    while (!book->tryLoad(snapshot)) {
     }
-    return std::nullopt;
+    snapshot.copyTo(out);
+    return true;
 }
 
-// MarketDataAggregator.cpp
-void MarketDataAggregator::updateSynthetic(const std::string& name, const SyntheticInstrument& synthetic) {
-    std::lock_guard<std::mutex> lock(dataMutex);
-    syntheticData[name] = synthetic;
+std::optional<FundingData> MarketDataAggregator::getFundingData(VenueId venue, InstrumentId instrument) const {
+    if (!inRange(venue, instrument)) return std::nullopt;
+    const Slot& slot = shards[venue].slots[instrument];
+    if (slot.funding.version() == 0) return std::nullopt;
+    return slot.funding.load();
 }
 
-const std::unordered_map<std::string, SyntheticInstrument>& MarketDataAggregator::getSyntheticData() const {
-    return syntheticData;
+void MarketDataAggregator::refresh(MarketSnapshot& snapshot) const {
+    snapshot.changes.clear();
+
+    const int instrumentCount = InstrumentRegistry::instrumentCount();
+    const int blocks = (instrumentCount + BLOCK - 1) / BLOCK;
+
+    for (VenueId venue = 0; venue < InstrumentRegistry::venueCount(); ++venue) {
+        const Shard& shard = shards[venue];
+        for (int b = 0; b < blocks; ++b) {
+            // Read before the slots: a write that lands after this load
+            // stamps the block again and is picked up next time
+            const uint64_t stamp = shard.blockVersions[b].load(std::memory_order_acquire);
+            uint64_t& seen = snapshot.blockVersions[venue * BLOCKS + b];
+            if (stamp == seen) continue;
+            seen = stamp;
+
+            const int end = std::min(instrumentCount, (b + 1) * BLOCK);
+            for (InstrumentId instrument = b * BLOCK; instrument < end; ++instrument) {
+                const Slot& slot = shard.slots[instrument];
+                auto& entry = snapshot.entries[venue * MAX_INSTRUMENTS + instrument];
+                bool changed = false;
+
+                if (slot.quote.version() != entry.quoteVersion) {
+                    while (!slot.quote.tryLoad(entry.top, entry.quoteVersion)) {
+                    }
+                    changed = true;
+                }
+                if (slot.funding.version() != entry.fundingVersion) {
+                    while (!slot.funding.tryLoad(entry.funding, entry.fundingVersion)) {
+                    }
+                    changed = true;
+                }
+                if (changed) snapshot.changes.emplace_back(venue, instrument);
+            }
+        }
+    }
+}
+
+void MarketDataAggregator::printSnapshot(InstrumentId instrument) {
+    std::cout << "\n=== Market Snapshot ===\n";
+    for (VenueId venue = 0; venue < InstrumentRegistry::venueCount(); ++venue) {
+        TopOfBook top;
+        if (!getLatest(venue, instrument, top)) continue;
+
+        std::cout << InstrumentRegistry::venueName(venue) << "  - "
+                  << InstrumentRegistry::instrumentName(instrument)
+                  << " | Bid: " << top.bestBid 
+                  << " | Ask: " << top.bestAsk << "\n";
+
+        auto funding = getFundingData(venue, instrument);
+        if (funding) {
+            std::cout << std::fixed << std::setprecision(10);
+            std::cout << "   ↳ Mark: " << funding->markPrice 
+                      << ", Funding: " << funding->fundingRate << "\n";
+        }
+    }
 }
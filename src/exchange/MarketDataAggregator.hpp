@@ -1,34 +1,162 @@
 #pragma once
 
 #include "MarketDataTypes.hpp"
-#include "arbitrage/SyntheticInstrumentCalculator.hpp" // For SyntheticInstrument
-#include <unordered_map>
+#include "SeqLock.hpp"
+#include "InstrumentRegistry.hpp"
 #include <string>
-#include <mutex>
 #include <optional>
+#include <functional>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
 
-struct FundingData {
-    double markPrice;
-    double fundingRate;
+// Fixed-size copy of a full OrderBookUpdate that can live in a SeqLock.
+// Backs the opt-in depth view; the hot path reads TopOfBook instead.
+struct BookSnapshot {
+    static constexpr size_t MAX_SYMBOL = 23;
+    static constexpr size_t MAX_DEPTH = 50; // matches the deepest book any client publishes
+
+    struct Level {
+        double price;
+        double qty;
+    };
+
+    char symbol[MAX_SYMBOL + 1];
+    InstrumentId instrument;
+    double bestBid;
+    double bestAsk;
+    double bestBidQty;
+    double bestAskQty;
+    double bidQty;
+    double askQty;
+    Timestamp timestamp;
+    MonoTimestamp receiveTime;
+    Timestamp exchangeTime;
+    uint32_t bidDepth;
+    uint32_t askDepth;
+    Level bids[MAX_DEPTH];
+    Level asks[MAX_DEPTH];
+
+    void assign(const OrderBookUpdate& update);
+    void copyTo(OrderBookUpdate& update) const;
 };
 
+// Reader-owned copy of the whole market state, brought up to date with
+// MarketDataAggregator::refresh(). A refresh only copies the quotes and
+// funding that changed since the previous one, so keeping a snapshot of
+// thousands of instruments costs in proportion to the traffic, not to the
+// size of the universe. Not shared between threads.
+class MarketSnapshot {
+public:
+    MarketSnapshot();
+
+    // nullptr if nothing arrived yet.
+    const TopOfBook* quote(VenueId venue, InstrumentId instrument) const;
+    const FundingData* funding(VenueId venue, InstrumentId instrument) const;
+
+    // (venue, instrument) pairs whose quote or funding changed in the last refresh.
+    const std::vector<std::pair<VenueId, InstrumentId>>& changed() const { return changes; }
+
+private:
+    friend class MarketDataAggregator;
+
+    struct Entry {
+        TopOfBook top;
+        FundingData funding;
+        uint64_t quoteVersion = 0;
+        uint64_t fundingVersion = 0;
+    };
+
+    const Entry* entry(VenueId venue, InstrumentId instrument) const;
+
+    std::vector<Entry> entries;          // venue * MAX_INSTRUMENTS + instrument
+    std::vector<uint64_t> blockVersions; // venue * BLOCKS + block, as last seen
+    std::vector<std::pair<VenueId, InstrumentId>> changes;
+};
+
+// Latest quote, funding and (opt-in) full book per venue and instrument,
+// indexed by InstrumentRegistry ids. The single market state of the engine.
+//
+// Sharded by venue: every venue owns its slots and change counters, so
+// writers for different venues never touch the same cache line. Each
+// slot's quote and funding are SeqLock-protected: writers never take a
+// lock or wait on readers, and readers get a consistent copy without
+// blocking anyone.
+//
+// Besides single reads, readers can keep a MarketSnapshot current with
+// refresh(). Every shard stamps a version per block of BLOCK instruments
+// on each write, so a refresh skips untouched blocks and copies only the
+// slots whose version moved.
+//
+// The full book up to BookSnapshot::MAX_DEPTH levels is kept only for
+// instruments passed to enableDepth(), since copying it costs ~13x more
+// per update than the 128-byte TopOfBook.
 class MarketDataAggregator {
 public:
-    void update(const std::string& exchange, const OrderBookUpdate& update);
-    void updateFundingAndMark(const std::string& exchange, double mark, double funding);
-    std::optional<FundingData> getFundingData(const std::string& exchange) const;
+    static constexpr int MAX_VENUES = InstrumentRegistry::MAX_VENUES;
+    static constexpr int MAX_INSTRUMENTS = InstrumentRegistry::MAX_INSTRUMENTS;
+    static constexpr int BLOCK = 64;
+    static constexpr int BLOCKS = MAX_INSTRUMENTS / BLOCK;
+
+    // Update keys: one per venue for quotes and one for funding. Dense, so
+    // listeners can index arrays with them.
+    static constexpr int MAX_KEYS = 2 * MAX_VENUES;
+    static constexpr int quoteKey(VenueId venue) { return 2 * venue; }
+    static constexpr int fundingKey(VenueId venue) { return 2 * venue + 1; }
+    // "Binance" -> quoteKey, "Binance:funding" -> fundingKey (registers the venue).
+    static int keyFor(const std::string& name);
+
+    // Called after every stored update with the key and instrument that
+    // changed and the receive time of the frame behind it. Runs on the
+    // writing thread. Set before feeds start.
+    using UpdateListener = std::function<void(int key, InstrumentId instrument, MonoTimestamp receivedAt)>;
+    void setUpdateListener(UpdateListener listener) { updateListener = std::move(listener); }
+
+    MarketDataAggregator();
+
+    // Keep the full book of an instrument for getBook(). Set before feeds start.
+    void enableDepth(InstrumentId instrument);
+
+    // update(venue, book) == updateBook(venue, book) + update(TopOfBook::from(venue, book)).
+    // Keyed by the instrument stamped on the update; updates without one are dropped.
+    void update(VenueId venue, const OrderBookUpdate& update);
+    void update(const TopOfBook& top);
+    void updateBook(VenueId venue, const OrderBookUpdate& update); // depth view only; no-op unless enabled
+    void updateFunding(VenueId venue, InstrumentId instrument, const FundingData& funding);
 
-    const std::unordered_map<std::string, OrderBookUpdate>& getLatestUpdates() const;
-    const std::unordered_map<std::string, SyntheticInstrument>& getSyntheticData() const;
+    // Consistent copy of the latest top of book; false if none yet.
+    bool getLatest(VenueId venue, InstrumentId instrument, TopOfBook& out) const;
 
-    void updateSynthetic(const std::string& name, const SyntheticInstrument& synthetic);
+    // Full book view of the same update; false if none yet or depth is disabled.
+    bool getBook(VenueId venue, InstrumentId instrument, OrderBookUpdate& out) const;
 
-    void printSnapshot();
+    std::optional<FundingData> getFundingData(VenueId venue, InstrumentId instrument) const;
+
+    // Brings `snapshot` up to date; see MarketSnapshot.
+    void refresh(MarketSnapshot& snapshot) const;
+
+    // Every venue's quote and funding for one instrument.
+    void printSnapshot(InstrumentId instrument);
 
 private:
-    mutable std::mutex dataMutex;
+    struct Slot {
+        SeqLock<TopOfBook> quote;
+        SeqLock<FundingData> funding;
+    };
+
+    struct alignas(64) Shard {
+        std::unique_ptr<Slot[]> slots;                          // MAX_INSTRUMENTS
+        std::unique_ptr<std::atomic<uint64_t>[]> blockVersions; // BLOCKS
+        std::vector<std::unique_ptr<SeqLock<BookSnapshot>>> books; // only enableDepth() instruments
+        alignas(64) std::atomic<uint64_t> writes{0};
+    };
+
+    static bool inRange(VenueId venue, InstrumentId instrument);
+    void markChanged(Shard& shard, InstrumentId instrument);
+
+    std::array<Shard, MAX_VENUES> shards;
 
-    std::unordered_map<std::string, OrderBookUpdate> exchangeData;
-    std::unordered_map<std::string, FundingData> fundingInfo;
-    std::unordered_map<std::string, SyntheticInstrument> syntheticData;
+    UpdateListener updateListener;
 };
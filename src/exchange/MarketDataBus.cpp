@@ -0,0 +1,181 @@
+#include "MarketDataBus.hpp"
+#include <iomanip>
+#include <iostream>
+
+MarketDataBus::~MarketDataBus() {
+    stop();
+}
+
+int MarketDataBus::addVenue(const std::string& name, size_t capacity) {
+    venues.push_back({name, std::make_unique<MulticastRing<TopOfBook>>(capacity)});
+    return static_cast<int>(venues.size()) - 1;
+}
+
+int MarketDataBus::addConsumer(const std::string& name, Handler handler, const std::vector<int>& after) {
+    const int id = static_cast<int>(consumers.size());
+
+    auto consumer = std::make_unique<Consumer>();
+    consumer->name = name;
+    consumer->handler = std::move(handler);
+    for (int dependency : after) {
+        if (dependency >= 0 && dependency < id) {
+            consumer->after.push_back(dependency);
+        } else {
+            std::cerr << "❌ MarketDataBus: " << name << " can only wait on earlier consumers, ignoring " << dependency << std::endl;
+        }
+    }
+
+    consumer->sequences = std::make_unique<Sequence[]>(venues.size());
+    for (size_t v = 0; v < venues.size(); ++v) venues[v].ring->addGatingSequence(consumer->sequences[v]);
+
+    consumers.push_back(std::move(consumer));
+    return id;
+}
+
+void MarketDataBus::publish(int venue, const TopOfBook& top) {
+    if (venue < 0 || venue >= static_cast<int>(venues.size())) return;
+    if (!venues[venue].ring->tryPublish(top)) return;
+
+    notifyWaiters();
+
+    // Only the first update since the polled consumer last looked pays for the wakeup
+    if (wake && !signaled.load(std::memory_order_relaxed) && !signaled.exchange(true, std::memory_order_acq_rel)) {
+        wake();
+    }
+}
+
+void MarketDataBus::notifyWaiters() {
+    // Pairs with the waiter count taken under waitMutex in run(): either the
+    // waiter sees the new sequence before sleeping, or we see it waiting
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters.load(std::memory_order_seq_cst) > 0) {
+        std::lock_guard<std::mutex> lock(waitMutex);
+        waitCv.notify_all();
+    }
+}
+
+int64_t MarketDataBus::available(const Consumer& consumer, int venue) const {
+    int64_t limit = venues[venue].ring->published();
+    for (int dependency : consumer.after) {
+        limit = std::min(limit, consumers[dependency]->sequences[venue].load());
+    }
+    return limit;
+}
+
+bool MarketDataBus::hasWork(const Consumer& consumer) const {
+    for (int v = 0; v < static_cast<int>(venues.size()); ++v) {
+        if (available(consumer, v) > consumer.sequences[v].load()) return true;
+    }
+    return false;
+}
+
+bool MarketDataBus::poll(int id) {
+    if (id < 0 || id >= static_cast<int>(consumers.size())) return false;
+
+    // Cleared before reading, so anything published from here on signals again
+    signaled.store(false, std::memory_order_release);
+    return process(*consumers[id]);
+}
+
+bool MarketDataBus::process(Consumer& consumer) {
+    bool more = false;
+    bool progressed = false;
+    for (int v = 0; v < static_cast<int>(venues.size()); ++v) {
+        Sequence& sequence = consumer.sequences[v];
+        const int64_t next = sequence.value.load(std::memory_order_relaxed) + 1;
+        const int64_t lag = venues[v].ring->published() - (next - 1);
+        if (lag > consumer.maxLag.load(std::memory_order_relaxed)) consumer.maxLag.store(lag, std::memory_order_relaxed);
+
+        const int64_t limit = available(consumer, v);
+        if (limit < next) continue;
+
+        const int64_t end = std::min<int64_t>(limit, next + static_cast<int64_t>(BATCH) - 1);
+        const auto& ring = *venues[v].ring;
+        for (int64_t s = next; s <= end; ++s) consumer.handler(ring.get(s));
+
+        sequence.store(end);
+        consumer.processed.fetch_add(static_cast<uint64_t>(end - next + 1), std::memory_order_relaxed);
+        progressed = true;
+        if (end < limit) more = true;
+    }
+
+    // Consumers gated on this one may be asleep
+    if (progressed) notifyWaiters();
+    return more;
+}
+
+void MarketDataBus::start(int id, WaitStrategy wait) {
+    if (id < 0 || id >= static_cast<int>(consumers.size())) return;
+    Consumer& consumer = *consumers[id];
+    consumer.thread = std::thread([this, &consumer, wait] { run(consumer, wait); });
+}
+
+void MarketDataBus::run(Consumer& consumer, WaitStrategy wait) {
+    while (running.load(std::memory_order_acquire)) {
+        if (process(consumer) || hasWork(consumer)) continue;
+
+        switch (wait) {
+            case WaitStrategy::BusySpin:
+                break;
+            case WaitStrategy::Yield:
+                std::this_thread::yield();
+                break;
+            case WaitStrategy::Block: {
+                std::unique_lock<std::mutex> lock(waitMutex);
+                waiters.fetch_add(1, std::memory_order_seq_cst);
+                // Timed, so a missed notify costs a little latency, not a hang
+                waitCv.wait_for(lock, std::chrono::milliseconds(100), [this, &consumer] {
+                    return hasWork(consumer) || !running.load(std::memory_order_acquire);
+                });
+                waiters.fetch_sub(1, std::memory_order_seq_cst);
+                break;
+            }
+        }
+    }
+}
+
+void MarketDataBus::stop() {
+    running.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(waitMutex);
+        waitCv.notify_all();
+    }
+    for (auto& consumer : consumers) {
+        if (consumer->thread.joinable()) consumer->thread.join();
+    }
+}
+
+void MarketDataBus::printStats() {
+    std::cout << "📨 Market Data Bus" << std::string(18, ' ')
+              << " published   dropped  capacity\n";
+    for (auto& venue : venues) {
+        const auto& ring = *venue.ring;
+        const uint64_t published = static_cast<uint64_t>(ring.published() + 1);
+        const uint64_t dropped = ring.droppedCount();
+
+        std::cout << "   ➤ " << std::left << std::setw(26) << venue.name << std::right
+                  << std::setw(10) << published - venue.reportedPublished
+                  << std::setw(10) << dropped - venue.reportedDropped
+                  << std::setw(10) << ring.capacity();
+        if (dropped > venue.reportedDropped) std::cout << "  ⚠️ a consumer fell a full ring behind";
+        std::cout << "\n";
+
+        venue.reportedPublished = published;
+        venue.reportedDropped = dropped;
+    }
+
+    std::cout << "   consumers" << std::string(26, ' ') << " processed       lag   max lag\n";
+    for (auto& consumer : consumers) {
+        int64_t lag = 0;
+        for (int v = 0; v < static_cast<int>(venues.size()); ++v) {
+            lag = std::max(lag, venues[v].ring->published() - consumer->sequences[v].load());
+        }
+        const uint64_t processed = consumer->processed.load(std::memory_order_relaxed);
+
+        std::cout << "   ➤ " << std::left << std::setw(26) << consumer->name << std::right
+                  << std::setw(10) << processed - consumer->reportedProcessed
+                  << std::setw(10) << lag
+                  << std::setw(10) << std::max(lag, consumer->maxLag.exchange(0, std::memory_order_relaxed)) << "\n";
+        consumer->reportedProcessed = processed;
+    }
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include "MarketDataTypes.hpp"
+#include "Disruptor.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Multicast bus for normalized top-of-book updates.
+//
+// Each venue (exchange client) writes into its own pre-allocated
+// MulticastRing from its network thread. Every consumer sees every update
+// of every venue, at its own pace, through its own per-venue cursors:
+//
+//   - a consumer either runs on its own thread with a WaitStrategy
+//     (start()), or is polled from an existing loop (poll(), e.g. as a
+//     StrategyDispatcher source);
+//   - a consumer can be gated on others (`after`): it only sees a
+//     sequence once all of them have finished with it, e.g. risk after
+//     the state the strategies read has been updated.
+//
+// Feed threads never wait on consumers: if a venue's ring is full because
+// the slowest consumer fell a whole ring behind, the update is dropped and
+// counted (see printStats()).
+class MarketDataBus {
+public:
+    using Handler = std::function<void(const TopOfBook& top)>;
+    using WakeHandler = std::function<void()>;
+
+    static constexpr size_t DEFAULT_CAPACITY = 4096;
+    static constexpr size_t BATCH = 256; // per venue per poll
+
+    MarketDataBus() = default;
+    ~MarketDataBus();
+    MarketDataBus(const MarketDataBus&) = delete;
+    MarketDataBus& operator=(const MarketDataBus&) = delete;
+
+    // Startup only, before anything is published: all venues, then all
+    // consumers. `after` must name consumers added earlier.
+    int addVenue(const std::string& name, size_t capacity = DEFAULT_CAPACITY);
+    int addConsumer(const std::string& name, Handler handler, const std::vector<int>& after = {});
+
+    // Called (once per burst) when a venue publishes, for polled consumers.
+    void setWakeHandler(WakeHandler handler) { wake = std::move(handler); }
+
+    // The venue's writer thread; must always be the same thread per venue.
+    void publish(int venue, const TopOfBook& top);
+
+    // Runs the consumer on the calling thread over up to BATCH updates per
+    // venue. Returns true if it left work behind.
+    bool poll(int consumer);
+
+    // Runs the consumer on its own thread until stop().
+    void start(int consumer, WaitStrategy wait);
+    void stop();
+
+    // Per venue: published and dropped. Per consumer: processed, lag behind
+    // the producers now, and the largest lag it found when it polled (its
+    // high-water mark). Counters and marks are per reporting window.
+    void printStats();
+
+private:
+    struct Venue {
+        std::string name;
+        std::unique_ptr<MulticastRing<TopOfBook>> ring;
+        uint64_t reportedPublished = 0;
+        uint64_t reportedDropped = 0;
+    };
+
+    struct Consumer {
+        std::string name;
+        Handler handler;
+        std::vector<int> after;
+        std::unique_ptr<Sequence[]> sequences; // one per venue
+        std::atomic<uint64_t> processed{0};
+        std::atomic<int64_t> maxLag{0}; // written by the consumer, reset by printStats()
+        uint64_t reportedProcessed = 0;
+        std::thread thread;
+    };
+
+    int64_t available(const Consumer& consumer, int venue) const;
+    bool hasWork(const Consumer& consumer) const;
+    bool process(Consumer& consumer);
+    void run(Consumer& consumer, WaitStrategy wait);
+    void notifyWaiters();
+
+    std::vector<Venue> venues;
+    std::vector<std::unique_ptr<Consumer>> consumers;
+
+    std::atomic<bool> running{true};
+    std::atomic<bool> signaled{false};
+    WakeHandler wake;
+
+    // Block wait strategy
+    std::mutex waitMutex;
+    std::condition_variable waitCv;
+    std::atomic<int> waiters{0};
+};
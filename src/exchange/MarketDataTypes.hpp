@@ -2,18 +2,109 @@
 #include <string>
 #include <vector>
 #include <chrono>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
 
 using Timestamp = std::chrono::system_clock::time_point;
+using MonoTimestamp = std::chrono::steady_clock::time_point;
+
+// Dense ids handed out by InstrumentRegistry at startup; -1 = unknown.
+using VenueId = int;
+using InstrumentId = int;
+
+// When a frame came off the socket. Stamped once in the websocket handler,
+// before parsing, and copied into every update built from that frame.
+struct ReceiveTime {
+    Timestamp wall;
+    MonoTimestamp mono;
+
+    static ReceiveTime now() {
+        return {std::chrono::system_clock::now(), std::chrono::steady_clock::now()};
+    }
+};
 
 struct OrderBookUpdate {
-    std::string symbol;
+    std::string symbol;           // venue spelling ("BTC-USDT", "BTCUSDT")
+    InstrumentId instrument = -1; // canonical instrument, stamped by the client
     double bestBid;
     double bestAsk;
     std::vector<std::pair<double, double>> bids; // price, quantity
     std::vector<std::pair<double, double>> asks;
-    Timestamp timestamp;
+    Timestamp timestamp;          // local receive time (wall clock)
+    MonoTimestamp receiveTime{};  // local receive time (monotonic), for latency
+    Timestamp exchangeTime{};     // venue event time (E / ts / cts); epoch if the venue sends none
     double bestBidQty;
     double bestAskQty;
     double bidQty = 0.0;
     double askQty = 0.0;
 };
+
+// Fixed-size top of book for the hot path: two cache lines, trivially
+// copyable, no heap. Built from an OrderBookUpdate once at ingestion and
+// passed by value from there on; the variable-depth OrderBookUpdate is only
+// read by code that walks the book (see MarketDataAggregator::getBook).
+struct alignas(64) TopOfBook {
+    static constexpr size_t DEPTH = 3; // levels per side, best included
+
+    struct Level {
+        double price;
+        double qty;
+    };
+
+    // Cache line 1: identity, best bid/ask, times
+    InstrumentId instrument;
+    int16_t venue;
+    uint8_t bidDepth;             // levels held per side, best included
+    uint8_t askDepth;
+    double bestBid;
+    double bestAsk;
+    double bestBidQty;
+    double bestAskQty;
+    Timestamp timestamp;          // local receive time (wall clock)
+    MonoTimestamp receiveTime;    // local receive time (monotonic)
+    Timestamp exchangeTime;       // venue event time; epoch if none
+
+    // Cache line 2: the levels behind the best
+    Level nextBids[DEPTH - 1];
+    Level nextAsks[DEPTH - 1];
+
+    double mid() const { return (bestBid + bestAsk) / 2.0; }
+    // No sides at all: the venue's book for the instrument lost its sequence
+    // and its last quote must not be used until a snapshot restores it.
+    bool withdrawn() const { return bestBid <= 0.0 && bestAsk <= 0.0; }
+    Level bid(size_t i) const { return i == 0 ? Level{bestBid, bestBidQty} : nextBids[i - 1]; }
+    Level ask(size_t i) const { return i == 0 ? Level{bestAsk, bestAskQty} : nextAsks[i - 1]; }
+
+    static TopOfBook from(VenueId venue, const OrderBookUpdate& update) {
+        TopOfBook top{};
+        top.instrument = update.instrument;
+        top.venue = static_cast<int16_t>(venue);
+        top.bestBid = update.bestBid;
+        top.bestAsk = update.bestAsk;
+        top.bestBidQty = update.bestBidQty;
+        top.bestAskQty = update.bestAskQty;
+        top.timestamp = update.timestamp;
+        top.receiveTime = update.receiveTime;
+        top.exchangeTime = update.exchangeTime;
+
+        // Ticker-only feeds carry no levels: the best alone is depth 1
+        top.bidDepth = static_cast<uint8_t>(std::clamp<size_t>(update.bids.size(), top.bestBidQty > 0 ? 1 : 0, DEPTH));
+        top.askDepth = static_cast<uint8_t>(std::clamp<size_t>(update.asks.size(), top.bestAskQty > 0 ? 1 : 0, DEPTH));
+        for (size_t i = 1; i < top.bidDepth && i < update.bids.size(); ++i)
+            top.nextBids[i - 1] = {update.bids[i].first, update.bids[i].second};
+        for (size_t i = 1; i < top.askDepth && i < update.asks.size(); ++i)
+            top.nextAsks[i - 1] = {update.asks[i].first, update.asks[i].second};
+        return top;
+    }
+};
+
+static_assert(std::is_trivially_copyable_v<TopOfBook>);
+static_assert(sizeof(TopOfBook) == 128, "TopOfBook should stay two cache lines");
+
+struct FundingData {
+    double markPrice;
+    double fundingRate;
+    double indexPrice = 0.0;
+    int64_t nextFundingTime = 0; // ms since epoch
+};
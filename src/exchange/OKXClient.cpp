@@ -8,17 +8,31 @@
 #include <thread>
 #include <chrono>
 #include <filesystem> // ✅ Needed for checking cert path
+#include <algorithm>
 #include "MarketDataTypes.hpp"
+#include "TransportManager.hpp"
+#include "FeedJournal.hpp"
+#include "InstrumentRegistry.hpp"
 
 using json = nlohmann::json;
 using WebSocketClient = websocketpp::client<websocketpp::config::asio_tls_client>;
 
-OKXClient::OKXClient(const std::string& symbol) : symbol(symbol), connected(false) {
+OKXClient::OKXClient(const std::string& symbol, const std::string& channel)
+    : OKXClient(std::vector<std::string>{symbol}, channel) {}
+
+OKXClient::OKXClient(const std::vector<std::string>& symbols, const std::string& channel)
+    : channel(channel), connected(false), sequence(InstrumentRegistry::registerVenue("OKX"), symbols.size(), [this](int id) { resubscribe(id); }) {
+    for (const auto& s : symbols) symbolTable.add(s);
+    books = std::vector<BookState>(symbolTable.size());
+    for (size_t id = 0; id < books.size(); ++id) {
+        books[id].update.symbol = symbolTable.name(static_cast<int>(id));
+        books[id].update.instrument = InstrumentRegistry::registerInstrument(books[id].update.symbol);
+    }
+
     ws.clear_access_channels(websocketpp::log::alevel::all);  // Optional: disable logs
-    ws.init_asio();
 
     // ✅ TLS Handler
-    ws.set_tls_init_handler([](websocketpp::connection_hdl) {
+    ws.set_tls_init_handler([this](websocketpp::connection_hdl) {
         auto ctx = std::make_shared<asio::ssl::context>(asio::ssl::context::tlsv12_client);
         try {
             ctx->set_options(
@@ -29,6 +43,13 @@ OKXClient::OKXClient(const std::string& symbol) : symbol(symbol), connected(fals
                 asio::ssl::context::no_tlsv1_1
             );
 
+            // The local mock exchange uses a self-signed certificate; any
+            // other host, overridden or not, is verified against the CA file
+            if (endpointIsLoopback()) {
+                ctx->set_verify_mode(asio::ssl::verify_none);
+                return ctx;
+            }
+
             std::string certPath = R"(D:\SyntheticPairDeviationEngine\certs\cacert.pem)";
             if (!std::filesystem::exists(certPath)) {
                 std::cerr << "❌ CA file not found at: " << certPath << std::endl;
@@ -45,12 +66,21 @@ OKXClient::OKXClient(const std::string& symbol) : symbol(symbol), connected(fals
 
     // ✅ Message Handler
     ws.set_message_handler([this](websocketpp::connection_hdl, WebSocketClient::message_ptr msg) {
-        handleIncomingMessage(msg->get_payload());
+        const auto received = ReceiveTime::now();
+        if (journal) journal->append(FeedVenue::OKX, 0, msg->get_payload(), received);
+        handleIncomingMessage(msg->get_payload(), received);
     });
 }
 
 void OKXClient::connect() {
-    const std::string uri = "wss://ws.okx.com:443/ws/v5/public";
+    const std::string uri = (endpoint.empty() ? "wss://ws.okx.com:443" : endpoint) + "/ws/v5/public";
+
+    if (transport) {
+        ws.init_asio(&transport->assign(name()));
+    } else {
+        ws.init_asio();
+    }
+
     websocketpp::lib::error_code ec;
     auto con = ws.get_connection(uri, ec);
 
@@ -63,35 +93,38 @@ void OKXClient::connect() {
 
     // ✅ Open Handler to send subscription
     con->set_open_handler([this](websocketpp::connection_hdl hdl) {
-    const std::string subscription = R"({
-        "op": "subscribe",
-        "args": [{
-            "channel": "books5",
-            "instId": "BTC-USDT"
-        }]
-    })";
-
     websocketpp::lib::error_code ec;
 
-    
-    ws.send(hdl, subscription, websocketpp::frame::opcode::text, ec);
+    for (const auto& subscription : subscriptionMessages("subscribe")) {
+        ws.send(hdl, subscription, websocketpp::frame::opcode::text, ec);
+        if (ec) break;
+    }
 
     if (ec) {
         std::cerr << "❌ OKX subscription error: " << ec.message() << std::endl;
     } else {
-        std::cout << "🔌 Connected to OKX spot\n";
+        std::cout << "🔌 Connected to OKX spot (" << symbolTable.size() << " symbols)\n";
         connected = true;
     }
 });
 
+    conn_hdl = con->get_handle();
     ws.connect(con);
 
-    std::thread([this]() {
-        ws.run();
-    }).detach();
+    if (!transport) {
+        std::thread([this]() {
+            ws.run();
+        }).detach();
+    }
 }
 
 void OKXClient::disconnect() {
+    if (transport) {
+        // Stopping the endpoint would stop the shared io_context; close only our connection.
+        websocketpp::lib::error_code ec;
+        ws.close(conn_hdl, websocketpp::close::status::going_away, "Client disconnect", ec);
+        return;
+    }
     ws.stop();
 }
 
@@ -99,28 +132,119 @@ std::string OKXClient::name() const {
     return "OKX";
 }
 
-void OKXClient::handleIncomingMessage(const std::string& payload) {
+std::string OKXClient::subscriptionMessage(const std::string& op, size_t first, size_t last) const {
+    json args = json::array();
+    for (size_t id = first; id < last; ++id) {
+        args.push_back({{"channel", channel}, {"instId", symbolTable.name(static_cast<int>(id))}});
+    }
+    json msg = {{"op", op}, {"args", args}};
+    return msg.dump();
+}
+
+std::vector<std::string> OKXClient::subscriptionMessages(const std::string& op) const {
+    std::vector<std::string> messages;
+    for (size_t i = 0; i < symbolTable.size(); i += MAX_ARGS_PER_REQUEST) {
+        messages.push_back(subscriptionMessage(op, i, std::min(i + MAX_ARGS_PER_REQUEST, symbolTable.size())));
+    }
+    return messages;
+}
+
+void OKXClient::resetSequences() {
+    for (auto& state : books) state.book.clear();
+    sequence.reset();
+}
+
+void OKXClient::resubscribe(int id) {
+    // Unsubscribe + subscribe makes OKX push a fresh snapshot for this instrument only.
+    books[id].book.clear();
+    if (!connected) return; // replay: the recorded snapshot follows anyway
+
+    websocketpp::lib::error_code ec;
+    ws.send(conn_hdl, subscriptionMessage("unsubscribe", id, id + 1), websocketpp::frame::opcode::text, ec);
+    ws.send(conn_hdl, subscriptionMessage("subscribe", id, id + 1), websocketpp::frame::opcode::text, ec);
+    if (ec) {
+        std::cerr << "❌ OKX resubscribe error: " << ec.message() << std::endl;
+    }
+}
+
+void OKXClient::applyLevels(OrderBook& book, const json& levels, OrderBook::Side side) {
+    // OKX level: [price, size, deprecated, numOrders]; size "0" deletes the level
+    for (const auto& level : levels) {
+        const auto& px = level[0].get_ref<const std::string&>();
+        const auto& sz = level[1].get_ref<const std::string&>();
+        book.apply(side, std::stod(px), std::stod(sz), px, sz);
+    }
+}
+
+void OKXClient::handleIncomingMessage(const std::string& payload, const ReceiveTime& received) {
     try {
+        sequence.poll(received.mono);
+
         auto j = json::parse(payload);
 
-        if (!j.contains("data") || j["data"].empty()) return;
+        if (j.contains("event")) {
+            if (j["event"] == "error") {
+                std::cerr << "❌ OKX error: " << j.value("msg", "") << std::endl;
+            }
+            return;
+        }
+
+        if (!j.contains("data") || j["data"].empty() || !j.contains("arg")) return;
         const auto& data = j["data"][0];
 
+        int id = symbolTable.find(j["arg"].value("instId", ""));
+        if (id == SymbolTable::NOT_FOUND) return;
+        auto& state = books[id];
+        auto& book = state.book;
+
         if (!data.contains("bids") || !data.contains("asks")) return;
-        const auto& bids = data["bids"];
-        const auto& asks = data["asks"];
 
-        if (bids.empty() || asks.empty()) return;
+        // books5 pushes a full 5-level book every time; books sends a
+        // snapshot followed by incremental updates, each carrying the
+        // previous update's seqId as prevSeqId.
+        bool isSnapshot = j.value("action", "snapshot") == "snapshot";
+        const int64_t seqId = data.value("seqId", int64_t{0});
+        if (isSnapshot) {
+            book.clear();
+            sequence.snapshot(id, seqId, received.mono);
+        } else if (!sequence.valid(id)) {
+            return; // waiting for the snapshot after a resync
+        } else if (!sequence.advance(id, data.value("prevSeqId", sequence.last(id)), seqId, received.mono)) {
+            std::cerr << "❌ OKX sequence gap on " << symbolTable.name(id) << " (expected prevSeqId="
+                      << sequence.last(id) << ", got " << data.value("prevSeqId", int64_t{0}) << "), resyncing book\n";
+            publishWithdrawn(state.update, received);
+            return;
+        }
+
+        applyLevels(book, data["bids"], OrderBook::Side::Bid);
+        applyLevels(book, data["asks"], OrderBook::Side::Ask);
+
+        if (book.textOverflow()) {
+            // Resyncing would bring the same field back: keep the book, unverified
+            if (!state.overflowReported) {
+                std::cerr << "❌ OKX level text on " << symbolTable.name(id) << " exceeds "
+                          << OrderBook::MAX_LEVEL_TEXT << " chars, checksum not verified\n";
+                state.overflowReported = true;
+            }
+        } else if (data.contains("checksum")) {
+            int32_t expected = data["checksum"].get<int32_t>();
+            if (book.okxChecksum() != expected) {
+                std::cerr << "❌ OKX checksum mismatch on " << symbolTable.name(id) << ", resyncing book\n";
+                sequence.invalidate(id, received.mono);
+                publishWithdrawn(state.update, received);
+                return;
+            }
+        }
 
-        OrderBookUpdate update;
-        update.symbol = symbol;
+        if (book.empty()) return;
 
-        // ✅ Parse prices and quantities
-        update.bestBid = std::stod(bids[0][0].get<std::string>());
-        update.bestAsk = std::stod(asks[0][0].get<std::string>());
-        update.bestBidQty = std::stod(bids[0][1].get<std::string>());
-        update.bestAskQty = std::stod(asks[0][1].get<std::string>());
-        update.timestamp = std::chrono::system_clock::now();
+        auto& update = state.update;
+        book.copyTo(update, MAX_PUBLISHED_DEPTH);
+        update.timestamp = received.wall;
+        update.receiveTime = received.mono;
+        // "ts" is a millisecond string
+        int64_t eventTime = data.contains("ts") && data["ts"].is_string() ? std::stoll(data["ts"].get_ref<const std::string&>()) : 0;
+        update.exchangeTime = eventTime ? Timestamp(std::chrono::milliseconds(eventTime)) : Timestamp{};
 
         if (orderBookCallback) {
             orderBookCallback(update);
@@ -1,23 +1,50 @@
 #pragma once
 #include "ExchangeClient.hpp"
+#include "MarketDataTypes.hpp"
+#include "OrderBook.hpp"
+#include "SequenceTracker.hpp"
+#include "SymbolTable.hpp"
 #include <websocketpp/config/asio_client.hpp>
 #include <websocketpp/client.hpp>
 #include <asio/ssl.hpp>
+#include <nlohmann/json.hpp>
+#include <vector>
 
 using WebSocketClient = websocketpp::client<websocketpp::config::asio_tls_client>;
 
 class OKXClient : public ExchangeClient {
 public:
-    OKXClient(const std::string& symbol);
+    // channel: "books5" (5-level snapshots) or "books" (400-level snapshot + updates)
+    OKXClient(const std::string& symbol, const std::string& channel = "books5");
+    OKXClient(const std::vector<std::string>& symbols, const std::string& channel = "books5");
 
     void connect() override;
     void disconnect() override;
     std::string name() const override;
+    void handleIncomingMessage(const std::string& msg, const ReceiveTime& received) override;
+    void resetSequences() override;
 
 private:
-    std::string symbol;
+    static constexpr size_t MAX_PUBLISHED_DEPTH = 50;
+    static constexpr size_t MAX_ARGS_PER_REQUEST = 50; // keeps each request far below OKX's 64 KB cap
+
+    struct BookState {
+        OrderBook book{true};
+        OrderBookUpdate update; // reused across messages to keep vector capacity
+        bool overflowReported = false;
+    };
+
+    std::string channel;
     bool connected;
 
+    SymbolTable symbolTable;       // instId ("BTC-USDT") -> id
+    std::vector<BookState> books;  // id -> book
+    SequenceTracker sequence;      // seqId / prevSeqId continuity per id
+
     WebSocketClient ws;
-    void handleIncomingMessage(const std::string& msg);
+    websocketpp::connection_hdl conn_hdl;
+    static void applyLevels(OrderBook& book, const nlohmann::json& levels, OrderBook::Side side);
+    std::string subscriptionMessage(const std::string& op, size_t first, size_t last) const;
+    std::vector<std::string> subscriptionMessages(const std::string& op) const;
+    void resubscribe(int id);
 };
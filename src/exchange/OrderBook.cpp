@@ -0,0 +1,124 @@
+#include "exchange/OrderBook.hpp"
+#include <algorithm>
+#include <string>
+
+namespace {
+    // Standard CRC-32 (IEEE 802.3), as used by the OKX book checksum.
+    const std::array<uint32_t, 256>& crcTable() {
+        static const std::array<uint32_t, 256> table = [] {
+            std::array<uint32_t, 256> t{};
+            for (uint32_t i = 0; i < 256; ++i) {
+                uint32_t c = i;
+                for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                t[i] = c;
+            }
+            return t;
+        }();
+        return table;
+    }
+
+    uint32_t crc32(const std::string& data) {
+        const auto& table = crcTable();
+        uint32_t crc = 0xFFFFFFFFu;
+        for (unsigned char ch : data) crc = table[(crc ^ ch) & 0xFF] ^ (crc >> 8);
+        return crc ^ 0xFFFFFFFFu;
+    }
+}
+
+OrderBook::OrderBook(bool keepLevelText) : keepText(keepLevelText) {
+    bids.reserve(512);
+    asks.reserve(512);
+    if (keepText) {
+        bidTexts.reserve(512);
+        askTexts.reserve(512);
+    }
+}
+
+void OrderBook::clear() {
+    bids.clear();
+    asks.clear();
+    bidTexts.clear();
+    askTexts.clear();
+    overflow = false;
+}
+
+void OrderBook::storeText(LevelText& text, std::string_view priceText, std::string_view qtyText) {
+    if (priceText.size() > text.price.size() || qtyText.size() > text.qty.size()) overflow = true;
+    text.priceLen = static_cast<uint8_t>(std::min(priceText.size(), text.price.size()));
+    text.qtyLen = static_cast<uint8_t>(std::min(qtyText.size(), text.qty.size()));
+    std::copy_n(priceText.data(), text.priceLen, text.price.data());
+    std::copy_n(qtyText.data(), text.qtyLen, text.qty.data());
+}
+
+void OrderBook::apply(Side side, double price, double qty, std::string_view priceText, std::string_view qtyText) {
+    auto& v = levels(side);
+
+    // Bids ascending, asks descending: best is always at the back.
+    auto it = (side == Side::Bid)
+        ? std::lower_bound(v.begin(), v.end(), price, [](const PriceLevel& l, double p) { return l.price < p; })
+        : std::lower_bound(v.begin(), v.end(), price, [](const PriceLevel& l, double p) { return l.price > p; });
+    size_t idx = static_cast<size_t>(it - v.begin());
+    bool exists = it != v.end() && it->price == price;
+
+    if (qty <= 0.0) {
+        if (exists) {
+            v.erase(it);
+            if (keepText) texts(side).erase(texts(side).begin() + idx);
+        }
+        return;
+    }
+
+    if (exists) {
+        it->qty = qty;
+        if (keepText) storeText(texts(side)[idx], priceText, qtyText);
+        return;
+    }
+
+    v.insert(it, PriceLevel{price, qty});
+    if (keepText) {
+        LevelText text;
+        storeText(text, priceText, qtyText);
+        texts(side).insert(texts(side).begin() + idx, text);
+    }
+}
+
+void OrderBook::copyTo(OrderBookUpdate& update, size_t maxDepth) const {
+    if (empty()) return;
+
+    update.bestBid = bids.back().price;
+    update.bestBidQty = bids.back().qty;
+    update.bestAsk = asks.back().price;
+    update.bestAskQty = asks.back().qty;
+
+    update.bids.clear();
+    update.asks.clear();
+    for (size_t i = 0; i < std::min(maxDepth, bids.size()); ++i) {
+        const auto& l = level(Side::Bid, i);
+        update.bids.emplace_back(l.price, l.qty);
+    }
+    for (size_t i = 0; i < std::min(maxDepth, asks.size()); ++i) {
+        const auto& l = level(Side::Ask, i);
+        update.asks.emplace_back(l.price, l.qty);
+    }
+}
+
+int32_t OrderBook::okxChecksum() const {
+    // "bid1Px:bid1Sz:ask1Px:ask1Sz:bid2Px:..." over the top 25 levels;
+    // a side that runs out is simply skipped.
+    std::string buf;
+    buf.reserve(25 * 4 * 16);
+
+    auto append = [&buf](const LevelText& t) {
+        if (!buf.empty()) buf.push_back(':');
+        buf.append(t.price.data(), t.priceLen);
+        buf.push_back(':');
+        buf.append(t.qty.data(), t.qtyLen);
+    };
+
+    for (size_t i = 0; i < 25; ++i) {
+        if (i < bidTexts.size()) append(bidTexts[bidTexts.size() - 1 - i]);
+        if (i < askTexts.size()) append(askTexts[askTexts.size() - 1 - i]);
+    }
+
+    return static_cast<int32_t>(crc32(buf));
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include "MarketDataTypes.hpp"
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+struct PriceLevel {
+    double price;
+    double qty;
+};
+
+// Local L2 book maintained from exchange snapshots + deltas.
+//
+// Each side is a contiguous sorted array with the best level at the *back*:
+// bids ascending, asks descending. Top-of-book is therefore O(1), and the
+// common case (changes near the touch) only shifts a few elements.
+//
+// OKX checksums are computed over the price/size strings exactly as the
+// exchange sent them, so the book can optionally keep the original text in
+// a parallel (cold) array. Texts longer than MAX_LEVEL_TEXT (far beyond any
+// venue's tick or lot precision) cannot be kept; the book then reports it
+// instead of checksumming a truncated copy.
+class OrderBook {
+public:
+    enum class Side { Bid, Ask };
+
+    static constexpr size_t MAX_LEVEL_TEXT = 32;
+
+    explicit OrderBook(bool keepLevelText = false);
+
+    void clear();
+
+    // Inserts, updates or (qty == 0) removes a level.
+    void apply(Side side, double price, double qty,
+               std::string_view priceText = {}, std::string_view qtyText = {});
+
+    bool empty() const { return bids.empty() || asks.empty(); }
+    size_t depth(Side side) const { return levels(side).size(); }
+
+    // i = 0 is the best level. No bounds check.
+    const PriceLevel& level(Side side, size_t i) const {
+        const auto& v = levels(side);
+        return v[v.size() - 1 - i];
+    }
+
+    const PriceLevel& bestBid() const { return bids.back(); }
+    const PriceLevel& bestAsk() const { return asks.back(); }
+
+    // Writes top-of-book and up to maxDepth levels per side (best first)
+    // into an update, reusing the update's vector capacity.
+    void copyTo(OrderBookUpdate& update, size_t maxDepth) const;
+
+    // OKX v5 CRC32 over the top 25 levels. Requires keepLevelText.
+    int32_t okxChecksum() const;
+    // A level's text did not fit since the last clear(): okxChecksum() can't match.
+    bool textOverflow() const { return overflow; }
+
+private:
+    struct LevelText {
+        std::array<char, MAX_LEVEL_TEXT> price;
+        std::array<char, MAX_LEVEL_TEXT> qty;
+        uint8_t priceLen = 0;
+        uint8_t qtyLen = 0;
+    };
+
+    std::vector<PriceLevel>& levels(Side side) { return side == Side::Bid ? bids : asks; }
+    const std::vector<PriceLevel>& levels(Side side) const { return side == Side::Bid ? bids : asks; }
+    std::vector<LevelText>& texts(Side side) { return side == Side::Bid ? bidTexts : askTexts; }
+
+    void storeText(LevelText& text, std::string_view priceText, std::string_view qtyText);
+
+    bool keepText;
+    bool overflow = false;
+    std::vector<PriceLevel> bids;
+    std::vector<PriceLevel> asks;
+    std::vector<LevelText> bidTexts;
+    std::vector<LevelText> askTexts;
+};
@@ -0,0 +1,93 @@
+#include "QuoteFreshness.hpp"
+#include <iomanip>
+#include <iostream>
+
+namespace {
+    int64_t toNs(MonoTimestamp t) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+    }
+}
+
+QuoteFreshness::QuoteFreshness(Clock clock)
+    : clock(clock), instruments(InstrumentRegistry::MAX_INSTRUMENTS) {
+    limitNs.fill(std::chrono::duration_cast<std::chrono::nanoseconds>(DEFAULT_LIMIT).count());
+    venueLastNs.fill(NEVER);
+}
+
+void QuoteFreshness::setLimit(VenueId venue, std::chrono::milliseconds limit) {
+    if (venue < 0 || venue >= MAX_VENUES) return;
+    limitNs[venue] = std::chrono::duration_cast<std::chrono::nanoseconds>(limit).count();
+}
+
+std::chrono::milliseconds QuoteFreshness::limit(VenueId venue) const {
+    if (venue < 0 || venue >= MAX_VENUES) return DEFAULT_LIMIT;
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::nanoseconds(limitNs[venue]));
+}
+
+MonoTimestamp QuoteFreshness::now() const {
+    if (clock == Clock::Recorded) return MonoTimestamp(std::chrono::duration_cast<MonoTimestamp::duration>(std::chrono::nanoseconds(latestNs)));
+    return std::chrono::steady_clock::now();
+}
+
+void QuoteFreshness::update(const TopOfBook& top) {
+    if (top.venue < 0 || top.venue >= MAX_VENUES) return;
+    if (top.instrument < 0 || top.instrument >= static_cast<int>(instruments.size())) return;
+
+    const int64_t at = top.receiveTime != MonoTimestamp{} ? toNs(top.receiveTime) : toNs(std::chrono::steady_clock::now());
+    instruments[top.instrument].lastNs[top.venue] = at;
+    venueLastNs[top.venue] = std::max(venueLastNs[top.venue], at);
+    latestNs = std::max(latestNs, at);
+}
+
+void QuoteFreshness::remove(VenueId venue, InstrumentId instrument) {
+    if (venue < 0 || venue >= MAX_VENUES) return;
+    if (instrument < 0 || instrument >= static_cast<int>(instruments.size())) return;
+    instruments[instrument].lastNs[venue] = NEVER;
+}
+
+uint32_t QuoteFreshness::freshMask(InstrumentId instrument) const {
+    if (instrument < 0 || instrument >= static_cast<int>(instruments.size())) return 0;
+    const auto& last = instruments[instrument].lastNs;
+    const int64_t nowNs = toNs(now());
+
+    uint32_t mask = 0;
+    for (int v = 0; v < MAX_VENUES; ++v) {
+        mask |= static_cast<uint32_t>(nowNs - last[v] <= limitNs[v]) << v;
+    }
+    return mask;
+}
+
+std::chrono::nanoseconds QuoteFreshness::age(VenueId venue, InstrumentId instrument) const {
+    if (venue < 0 || venue >= MAX_VENUES) return std::chrono::nanoseconds::max();
+    if (instrument < 0 || instrument >= static_cast<int>(instruments.size())) return std::chrono::nanoseconds::max();
+    const int64_t last = instruments[instrument].lastNs[venue];
+    if (last == NEVER) return std::chrono::nanoseconds::max();
+    return std::chrono::nanoseconds(toNs(now()) - last);
+}
+
+void QuoteFreshness::checkStalls() {
+    const int64_t nowNs = toNs(now());
+    const int venues = std::min(InstrumentRegistry::venueCount(), MAX_VENUES);
+
+    uint32_t active = 0;
+    for (int v = 0; v < venues; ++v) {
+        if (venueLastNs[v] != NEVER && nowNs - venueLastNs[v] <= limitNs[v]) active |= bit(v);
+    }
+
+    for (int v = 0; v < venues; ++v) {
+        if (venueLastNs[v] == NEVER) continue; // never connected; not a stall
+
+        const bool quiet = !(active & bit(v));
+        if (quiet && !stalled[v] && (active & ~bit(v))) {
+            stalled[v] = true;
+            std::cout << "⚠️ Feed stall: " << InstrumentRegistry::venueName(v) << " quiet for "
+                      << std::fixed << std::setprecision(1) << (nowNs - venueLastNs[v]) / 1e9
+                      << " s while other venues are updating\n";
+            if (stallListener) stallListener(v, true);
+        } else if (!quiet && stalled[v]) {
+            stalled[v] = false;
+            std::cout << "✅ Feed resumed: " << InstrumentRegistry::venueName(v) << "\n";
+            if (stallListener) stallListener(v, false);
+        }
+    }
+}
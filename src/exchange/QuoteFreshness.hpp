@@ -0,0 +1,75 @@
+#pragma once
+#include "MarketDataTypes.hpp"
+#include "InstrumentRegistry.hpp"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Age of every venue's latest quote per instrument, on the monotonic clock.
+//
+// The last receive time of an instrument's quotes on all venues shares one
+// cache line, so freshMask() (one bit per venue whose quote is within that
+// venue's staleness limit) is a handful of compares on a single line.
+// Strategies check the venues they are about to compare with one mask
+// test instead of trusting whatever the aggregator last held.
+//
+// checkStalls() is the stall detector: a venue that has been quiet for
+// longer than its limit while another venue is still updating is reported
+// once when it stalls and once when it comes back.
+//
+// Updated and read on the dispatcher thread.
+class QuoteFreshness {
+public:
+    static constexpr int MAX_VENUES = InstrumentRegistry::MAX_VENUES;
+    static constexpr std::chrono::milliseconds DEFAULT_LIMIT{2000};
+
+    // Called from checkStalls() when a venue stalls (true) or resumes (false).
+    using StallListener = std::function<void(VenueId venue, bool stalled)>;
+    void setStallListener(StallListener listener) { stallListener = std::move(listener); }
+
+    // Live: ages are measured against steady_clock::now(). Recorded: against
+    // the newest receive time seen, so a replay ages quotes by its own clock.
+    enum class Clock { Live, Recorded };
+    explicit QuoteFreshness(Clock clock = Clock::Live);
+
+    void setLimit(VenueId venue, std::chrono::milliseconds limit);
+    std::chrono::milliseconds limit(VenueId venue) const;
+
+    // Stamps top.venue / top.instrument with top.receiveTime (now if unset).
+    void update(const TopOfBook& top);
+    // Forgets the venue's quote for the instrument: not fresh until the next update().
+    void remove(VenueId venue, InstrumentId instrument);
+
+    // Bit v set when venue v's quote for the instrument is within its limit.
+    uint32_t freshMask(InstrumentId instrument) const;
+    static constexpr uint32_t bit(VenueId venue) { return 1u << venue; }
+    // All of `venues` are fresh for the instrument.
+    bool areFresh(InstrumentId instrument, uint32_t venues) const { return (freshMask(instrument) & venues) == venues; }
+
+    // Age of the venue's latest quote for the instrument; max() if none yet.
+    std::chrono::nanoseconds age(VenueId venue, InstrumentId instrument) const;
+
+    // Stall detector pass; run periodically.
+    void checkStalls();
+
+    MonoTimestamp now() const;
+
+private:
+    static constexpr int64_t NEVER = INT64_MIN / 2;
+
+    struct alignas(64) InstrumentTimes {
+        std::array<int64_t, MAX_VENUES> lastNs;
+        InstrumentTimes() { lastNs.fill(NEVER); }
+    };
+
+    Clock clock;
+    int64_t latestNs = NEVER; // newest receive time seen (Recorded clock)
+    std::array<int64_t, MAX_VENUES> limitNs;
+    std::array<int64_t, MAX_VENUES> venueLastNs;
+    std::array<bool, MAX_VENUES> stalled{};
+    std::vector<InstrumentTimes> instruments; // indexed by InstrumentId
+    StallListener stallListener;
+};
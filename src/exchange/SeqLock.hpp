@@ -0,0 +1,69 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Sequence lock around a trivially copyable value.
+//
+// Readers never block writers: they copy the value and retry if a write
+// overlapped (sequence odd, or changed during the copy). Writers never
+// wait on readers; concurrent writers to the same SeqLock serialize on
+// the sequence word itself.
+//
+// The payload copy races with writers by design; the fences below make
+// any torn copy detectable, and it is discarded before use. T must be
+// trivially copyable so a torn copy is harmless bytes, not a broken object.
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLock payload must be trivially copyable");
+
+public:
+    void store(const T& value) {
+        uint64_t seq = sequence.load(std::memory_order_relaxed);
+        for (;;) {
+            if ((seq & 1) == 0 &&
+                sequence.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                break;
+            }
+            seq = sequence.load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+
+        std::memcpy(&data, &value, sizeof(T));
+
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    T load() const {
+        T value;
+        while (!tryLoad(value)) {
+        }
+        return value;
+    }
+
+    // Single attempt; false if a write was in progress or overlapped.
+    bool tryLoad(T& value) const {
+        uint64_t version;
+        return tryLoad(value, version);
+    }
+
+    // Same, also returning the version() the copy belongs to.
+    bool tryLoad(T& value, uint64_t& version) const {
+        uint64_t before = sequence.load(std::memory_order_acquire);
+        if (before & 1) return false;
+
+        std::memcpy(&value, &data, sizeof(T));
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        version = before / 2;
+        return sequence.load(std::memory_order_relaxed) == before;
+    }
+
+    // Number of completed writes.
+    uint64_t version() const { return sequence.load(std::memory_order_acquire) / 2; }
+
+private:
+    alignas(64) std::atomic<uint64_t> sequence{0};
+    T data{};
+};
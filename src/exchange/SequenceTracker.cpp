@@ -0,0 +1,73 @@
+#include "SequenceTracker.hpp"
+#include "monitoring/SequenceMonitor.hpp"
+#include <algorithm>
+
+SequenceTracker::SequenceTracker(VenueId venue, size_t instruments, ResyncRequest resync)
+    : monitorVenue(venue), resync(std::move(resync)), states(instruments) {}
+
+void SequenceTracker::snapshot(int id, int64_t seq, MonoTimestamp at) {
+    auto& state = states[id];
+    if (state.resyncing) {
+        state.resyncing = false;
+        --pending;
+        SequenceMonitor::addPending(monitorVenue, -1);
+        SequenceMonitor::recordResync(monitorVenue, std::chrono::duration_cast<std::chrono::nanoseconds>(at - state.gapAt).count());
+    }
+    if (!state.valid) state.validSince = at;
+    state.valid = true;
+    state.last = seq;
+}
+
+bool SequenceTracker::advance(int id, int64_t prev, int64_t seq, MonoTimestamp at) {
+    auto& state = states[id];
+    if (prev == state.last) {
+        state.last = seq;
+        return true;
+    }
+    invalidate(id, at);
+    return false;
+}
+
+void SequenceTracker::invalidate(int id, MonoTimestamp at) {
+    auto& state = states[id];
+    SequenceMonitor::recordGap(monitorVenue);
+    if (state.valid && at - state.validSince >= STABLE_AFTER) state.attempts = 0;
+    state.valid = false;
+    if (state.resyncing) return; // a request is already out; its retry timer stands
+
+    state.resyncing = true;
+    state.gapAt = at;
+    // A book that gaps again soon after its last resync waits out the backoff
+    state.due = at + backoff(state.attempts);
+    nextDue = std::min(nextDue, state.due);
+    ++pending;
+    SequenceMonitor::addPending(monitorVenue, 1);
+    poll(at);
+}
+
+void SequenceTracker::reset() {
+    if (pending != 0) SequenceMonitor::addPending(monitorVenue, -pending);
+    std::fill(states.begin(), states.end(), State{});
+    pending = 0;
+    nextDue = MonoTimestamp::max();
+}
+
+MonoTimestamp::duration SequenceTracker::backoff(int attempts) {
+    if (attempts <= 0) return MonoTimestamp::duration::zero();
+    return std::min<MonoTimestamp::duration>(INITIAL_BACKOFF * (1LL << std::min(attempts - 1, 6)), MAX_BACKOFF);
+}
+
+void SequenceTracker::sendDue(MonoTimestamp now) {
+    nextDue = MonoTimestamp::max();
+    for (size_t id = 0; id < states.size(); ++id) {
+        auto& state = states[id];
+        if (!state.resyncing) continue;
+        if (now >= state.due) {
+            SequenceMonitor::recordResyncRequest(monitorVenue);
+            resync(static_cast<int>(id));
+            // Asks again if the snapshot has not arrived by the next backoff step
+            state.due = now + backoff(++state.attempts);
+        }
+        nextDue = std::min(nextDue, state.due);
+    }
+}
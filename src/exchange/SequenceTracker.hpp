@@ -0,0 +1,78 @@
+#pragma once
+#include "MarketDataTypes.hpp"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// Continuity of a client's per-instrument update sequence, and the resync
+// state machine around it. Ids are the client's SymbolTable ids.
+//
+// An instrument is valid from its snapshot until an update fails to follow
+// the previous one (or the client calls invalidate(), e.g. on a checksum
+// mismatch). Its updates are then dropped until a new snapshot arrives.
+// The client is asked to resync it at once for the first gap, then again
+// from poll() with exponential backoff (500 ms doubling to 30 s) while no
+// snapshot comes back or the instrument keeps gapping. The backoff resets
+// once a book has stayed valid for STABLE_AFTER.
+//
+// Gaps, requests, pending resyncs and gap-to-snapshot latency go to
+// SequenceMonitor. Used only on the client's feed thread; times come from
+// the frames' receive times, so a replay behaves like the live run.
+class SequenceTracker {
+public:
+    static constexpr std::chrono::milliseconds INITIAL_BACKOFF{500};
+    static constexpr std::chrono::milliseconds MAX_BACKOFF{30000};
+    static constexpr std::chrono::seconds STABLE_AFTER{30};
+
+    // resync(id) asks the venue for a fresh snapshot of that one instrument,
+    // leaving the connection and its other subscriptions untouched.
+    using ResyncRequest = std::function<void(int id)>;
+
+    // `venue` is the InstrumentRegistry id the metrics are recorded under.
+    SequenceTracker(VenueId venue, size_t instruments, ResyncRequest resync);
+
+    bool valid(int id) const { return states[id].valid; }
+    int64_t last(int id) const { return states[id].last; }
+
+    // A snapshot restarts the sequence at `seq` and completes any resync.
+    void snapshot(int id, int64_t seq, MonoTimestamp at);
+
+    // True if `prev` is the last sequence seen, which then advances to `seq`.
+    // Otherwise the instrument is invalidated and false returned.
+    bool advance(int id, int64_t prev, int64_t seq, MonoTimestamp at);
+
+    // Marks the instrument invalid and schedules a resync; the first one is
+    // requested before returning.
+    void invalidate(int id, MonoTimestamp at);
+
+    // Every instrument back to its initial state (no snapshot yet), pending
+    // resyncs dropped.
+    void reset();
+
+    // Sends the resync requests whose backoff has elapsed. A single compare
+    // when nothing is pending; clients call it on every frame.
+    void poll(MonoTimestamp now) {
+        if (pending != 0 && now >= nextDue) sendDue(now);
+    }
+
+private:
+    struct State {
+        bool valid = false;
+        bool resyncing = false;
+        int64_t last = 0;
+        int attempts = 0;           // resync requests since the book was last stable
+        MonoTimestamp gapAt{};      // detection of the gap being resynced
+        MonoTimestamp validSince{};
+        MonoTimestamp due{};        // next resync request
+    };
+
+    static MonoTimestamp::duration backoff(int attempts);
+    void sendDue(MonoTimestamp now);
+
+    VenueId monitorVenue;
+    ResyncRequest resync;
+    std::vector<State> states;
+    int pending = 0;
+    MonoTimestamp nextDue = MonoTimestamp::max();
+};
@@ -0,0 +1,71 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Maps exchange symbols to dense ids [0, size()) so per-symbol client state
+// can live in plain arrays. Built once at subscription time; lookups hash the
+// raw payload bytes and probe an open-addressed table, so dispatch never
+// builds a std::string or walks a list of string comparisons.
+class SymbolTable {
+public:
+    static constexpr int NOT_FOUND = -1;
+
+    // Returns the id of the symbol, adding it if it's new.
+    int add(std::string_view symbol) {
+        int existing = find(symbol);
+        if (existing != NOT_FOUND) return existing;
+
+        if ((names.size() + 1) * 2 > slots.size()) rehash(slots.empty() ? 16 : slots.size() * 2);
+
+        int id = static_cast<int>(names.size());
+        names.emplace_back(symbol);
+        hashes.push_back(hash(symbol));
+        insertSlot(id);
+        return id;
+    }
+
+    int find(std::string_view symbol) const {
+        if (slots.empty()) return NOT_FOUND;
+
+        uint64_t h = hash(symbol);
+        size_t mask = slots.size() - 1;
+        for (size_t i = h & mask;; i = (i + 1) & mask) {
+            int id = slots[i];
+            if (id == NOT_FOUND) return NOT_FOUND;
+            if (hashes[id] == h && names[id] == symbol) return id;
+        }
+    }
+
+    size_t size() const { return names.size(); }
+    const std::string& name(int id) const { return names[id]; }
+    const std::vector<std::string>& all() const { return names; }
+
+private:
+    // FNV-1a
+    static uint64_t hash(std::string_view s) {
+        uint64_t h = 1469598103934665603ULL;
+        for (unsigned char c : s) {
+            h ^= c;
+            h *= 1099511628211ULL;
+        }
+        return h;
+    }
+
+    void insertSlot(int id) {
+        size_t mask = slots.size() - 1;
+        size_t i = hashes[id] & mask;
+        while (slots[i] != NOT_FOUND) i = (i + 1) & mask;
+        slots[i] = id;
+    }
+
+    void rehash(size_t capacity) {
+        slots.assign(capacity, NOT_FOUND);
+        for (int id = 0; id < static_cast<int>(names.size()); ++id) insertSlot(id);
+    }
+
+    std::vector<std::string> names;
+    std::vector<uint64_t> hashes;
+    std::vector<int> slots; // power-of-two capacity, load factor <= 0.5
+};
@@ -0,0 +1,32 @@
+#include "TickHistory.hpp"
+#include <chrono>
+
+void TickSeries::append(const TopOfBook& top, double fundingRate) {
+    // Local receive time: comparable across venues, unlike their event clocks
+    time.push(std::chrono::duration_cast<std::chrono::nanoseconds>(top.timestamp.time_since_epoch()).count());
+    mid.push(top.mid());
+    spread.push(top.bestAsk - top.bestBid);
+    bidQty.push(top.bestBidQty);
+    askQty.push(top.bestAskQty);
+    funding.push(fundingRate);
+}
+
+TickHistory::TickHistory(size_t capacity)
+    : capacity(capacity),
+      entries(InstrumentRegistry::MAX_VENUES * InstrumentRegistry::MAX_INSTRUMENTS) {}
+
+void TickHistory::record(const TopOfBook& top, double fundingRate) {
+    if (top.venue < 0 || top.venue >= InstrumentRegistry::MAX_VENUES) return;
+    if (top.instrument < 0 || top.instrument >= InstrumentRegistry::MAX_INSTRUMENTS) return;
+    if (top.bestBid <= 0 || top.bestAsk <= 0) return;
+
+    auto& entry = entries[top.venue * InstrumentRegistry::MAX_INSTRUMENTS + top.instrument];
+    if (!entry) entry = std::make_unique<TickSeries>(capacity);
+    entry->append(top, fundingRate);
+}
+
+const TickSeries* TickHistory::series(VenueId venue, InstrumentId instrument) const {
+    if (venue < 0 || venue >= InstrumentRegistry::MAX_VENUES) return nullptr;
+    if (instrument < 0 || instrument >= InstrumentRegistry::MAX_INSTRUMENTS) return nullptr;
+    return entries[venue * InstrumentRegistry::MAX_INSTRUMENTS + instrument].get();
+}
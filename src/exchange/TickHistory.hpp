@@ -0,0 +1,62 @@
+#pragma once
+#include "MarketDataTypes.hpp"
+#include "InstrumentRegistry.hpp"
+#include "HistoryRing.hpp"
+#include <memory>
+#include <span>
+#include <vector>
+
+// Recent ticks of one instrument on one venue, column by column: one
+// HistoryRing per field, all advanced together by append(). Analytics
+// read the columns they need as contiguous spans, index-aligned across
+// columns (times()[i] is the time of mids()[i]).
+class TickSeries {
+public:
+    explicit TickSeries(size_t capacity)
+        : time(capacity), mid(capacity), spread(capacity), bidQty(capacity), askQty(capacity), funding(capacity) {}
+
+    void append(const TopOfBook& top, double fundingRate);
+
+    // Last n ticks (fewer if not that many yet), oldest first.
+    std::span<const int64_t> times(size_t n) const { return time.last(n); } // receive time, ns since epoch
+    std::span<const double> mids(size_t n) const { return mid.last(n); }
+    std::span<const double> spreads(size_t n) const { return spread.last(n); }
+    std::span<const double> bidQtys(size_t n) const { return bidQty.last(n); }
+    std::span<const double> askQtys(size_t n) const { return askQty.last(n); }
+    std::span<const double> fundingRates(size_t n) const { return funding.last(n); }
+
+    size_t size() const { return mid.size(); }
+    size_t capacity() const { return mid.capacity(); }
+
+private:
+    HistoryRing<int64_t> time;
+    HistoryRing<double> mid;
+    HistoryRing<double> spread;
+    HistoryRing<double> bidQty;
+    HistoryRing<double> askQty;
+    HistoryRing<double> funding;
+};
+
+// Shared tick history for every (venue, instrument) that has traded,
+// written once per normalized update and read in place by the analytics
+// (CorrelationAnalyzer, ...). Series are allocated on their first tick,
+// so only the markets actually fed cost memory.
+//
+// Written and read on the dispatcher thread.
+class TickHistory {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+    explicit TickHistory(size_t capacity = DEFAULT_CAPACITY);
+
+    // Appends a tick to top.venue / top.instrument; ticks without a valid
+    // two-sided quote are skipped.
+    void record(const TopOfBook& top, double fundingRate);
+
+    // nullptr until the first tick.
+    const TickSeries* series(VenueId venue, InstrumentId instrument) const;
+
+private:
+    size_t capacity;
+    std::vector<std::unique_ptr<TickSeries>> entries; // venue * MAX_INSTRUMENTS + instrument
+};
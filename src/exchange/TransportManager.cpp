@@ -0,0 +1,75 @@
+#include "exchange/TransportManager.hpp"
+#include <iostream>
+
+TransportManager::TransportManager(size_t threadCount) {
+    if (threadCount == 0) threadCount = 1;
+
+    for (size_t i = 0; i < threadCount; ++i) {
+        auto loop = std::make_unique<Loop>();
+        // Keeps run() alive while no connection is active yet (or during reconnects).
+        loop->workGuard = std::make_unique<WorkGuard>(asio::make_work_guard(loop->context));
+        loops.push_back(std::move(loop));
+    }
+}
+
+TransportManager::~TransportManager() {
+    stop();
+}
+
+asio::io_context& TransportManager::assign(const std::string& clientName) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto& loop = *loops[nextLoop];
+    nextLoop = (nextLoop + 1) % loops.size();
+    loop.clients.push_back(clientName);
+    return loop.context;
+}
+
+void TransportManager::start() {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (running) return;
+
+    for (auto& loop : loops) {
+        Loop* l = loop.get();
+        l->thread = std::thread([l]() {
+            // A throwing handler must not take down every client on this loop.
+            while (true) {
+                try {
+                    l->context.run();
+                    break;
+                } catch (const std::exception& e) {
+                    std::cerr << "❌ Transport loop error: " << e.what() << std::endl;
+                }
+            }
+        });
+    }
+
+    running = true;
+    std::cout << "🧵 Transport started with " << loops.size() << " event loop(s)\n";
+}
+
+void TransportManager::stop() {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (!running) return;
+
+    for (auto& loop : loops) {
+        loop->workGuard.reset();
+        loop->context.stop();
+    }
+    for (auto& loop : loops) {
+        if (loop->thread.joinable()) {
+            loop->thread.join();
+        }
+    }
+
+    running = false;
+}
+
+void TransportManager::printAssignments() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    std::cout << "🧵 Transport assignments:\n";
+    for (size_t i = 0; i < loops.size(); ++i) {
+        std::cout << "   ➤ Loop " << i << ":";
+        for (const auto& name : loops[i]->clients) std::cout << " " << name;
+        std::cout << "\n";
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <asio/io_context.hpp>
+#include <asio/executor_work_guard.hpp>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Owns a small, fixed pool of io_contexts shared by all exchange clients.
+// Each client is pinned to one loop (round-robin) at connect() time, so the
+// number of network threads stays at `threadCount` no matter how many
+// venues/symbols are subscribed.
+class TransportManager {
+public:
+    explicit TransportManager(size_t threadCount = 1);
+    ~TransportManager();
+
+    TransportManager(const TransportManager&) = delete;
+    TransportManager& operator=(const TransportManager&) = delete;
+
+    // Returns the io_context the named client should run on.
+    asio::io_context& assign(const std::string& clientName);
+
+    void start();
+    void stop();
+
+    size_t threadCount() const { return loops.size(); }
+    void printAssignments() const;
+
+private:
+    using WorkGuard = asio::executor_work_guard<asio::io_context::executor_type>;
+
+    struct Loop {
+        asio::io_context context;
+        std::unique_ptr<WorkGuard> workGuard;
+        std::thread thread;
+        std::vector<std::string> clients;
+    };
+
+    std::vector<std::unique_ptr<Loop>> loops;
+    size_t nextLoop = 0;
+    bool running = false;
+    mutable std::mutex mtx;
+};
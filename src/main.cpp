@@ -3,238 +3,269 @@
 #include "exchange/BybitClient.hpp"
 #include "exchange/MarketDataTypes.hpp"
 #include "exchange/MarketDataAggregator.hpp"
+#include "exchange/ConsolidatedBook.hpp"
+#include "exchange/TickHistory.hpp"
+#include "exchange/QuoteFreshness.hpp"
+#include "exchange/InstrumentRegistry.hpp"
+#include "exchange/MarketDataBus.hpp"
 #include "exchange/BinancePerpClient.hpp"
-#include "arbitrage/SyntheticInstrumentCalculator.hpp"
-#include "arbitrage/ArbitrageOpportunity.hpp"
-#include "arbitrage/ArbitrageLegOptimizer.hpp"
-#include "arbitrage/RiskManager.hpp"
+#include "exchange/TransportManager.hpp"
+#include "exchange/FeedJournal.hpp"
+#include "arbitrage/StrategyChecks.hpp"
+#include "arbitrage/StrategyDispatcher.hpp"
 #include "arbitrage/TradeExecutor.hpp"
 #include "monitoring/PerformanceMonitor.hpp"
-#include "arbitrage/options/VolatilityArbitrageDetector.hpp"
-#include "arbitrage/VolatilityArbitrage.hpp"
-#include "arbitrage/StatisticalArbitrageEngine.hpp"
+#include "monitoring/LatencyMonitor.hpp"
+#include "monitoring/SequenceMonitor.hpp"
 #include "monitoring/RiskDashboard.hpp"
 #include <iostream>
 #include <thread>
 #include <chrono>
 #include <memory>
+#include <atomic>
 #include <vector>
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
 #include <windows.h>
 #include "monitoring/VaREstimator.hpp"
-#include "monitoring/StressTester.hpp"
-#include "arbitrage/risk/CorrelationAnalyzer.hpp"
 
-void checkSyntheticFutures(MarketDataAggregator &aggregator)
-{
-    const auto &latestUpdates = aggregator.getLatestUpdates();
-    if (!latestUpdates.count("Binance") || !latestUpdates.count("OKX"))
-        return;
-
-    std::cout << "\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
-    std::cout << "🔍 SYNTHETIC FUTURES ANALYSIS\n";
-    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
-
-    const auto &binancePerp = latestUpdates.at("Binance");
-    const auto &okxSpot = latestUpdates.at("OKX");
-
-    double realSpot = (okxSpot.bestBid + okxSpot.bestAsk) / 2.0;
-    SyntheticInstrument syntheticSpot = SyntheticInstrumentCalculator::computeSyntheticSpot(binancePerp, 0.0005, 2.0);
-
-    auto fundingDataOpt = aggregator.getFundingData("Binance");
-    if (!fundingDataOpt)
-        return;
+// Number of shared network event loops for all exchange clients.
+// 0 = legacy mode (every client runs its own io_service thread).
+constexpr size_t SHARED_TRANSPORT_THREADS = 1;
 
-    double fundingRate = fundingDataOpt->fundingRate;
-    SyntheticInstrument syntheticFuture = SyntheticInstrumentCalculator::computeSyntheticFuture_FundingModel(okxSpot, fundingRate, 7.0 / 365.0);
+// Ctrl+C / Ctrl+Break / closing the console window end dispatcher.run(), so
+// main's shutdown path (transport stop, journal truncation) gets to run.
+std::atomic<StrategyDispatcher *> runningDispatcher{nullptr};
+std::atomic<bool> shutdownComplete{false};
 
-    double mispricing1 = SyntheticInstrumentCalculator::computeMispricing(realSpot, syntheticSpot.price);
-    double mispricing2 = SyntheticInstrumentCalculator::computeMispricing(realSpot, syntheticFuture.price);
-
-    std::cout << "📊 Real Spot (OKX): " << realSpot << "\n";
-    std::cout << "🧮 Synthetic Spot (Binance): " << syntheticSpot.price << " → Mispricing: " << mispricing1 << "%\n";
-    std::cout << "🧮 Synthetic Future (Funding Model): " << syntheticFuture.price << " → Mispricing: " << mispricing2 << "%\n";
+BOOL WINAPI onConsoleControl(DWORD event)
+{
+    StrategyDispatcher *dispatcher = runningDispatcher.load();
+    if (!dispatcher)
+        return FALSE;
 
-    RiskDashboard::displayFundingImpact("BTC/USDT", fundingRate, 10000.0);
-    RiskDashboard::displayLiquidityAlert("BTC/USDT", okxSpot, 2.0);
-    RiskDashboard::displayBasisRisk("BTC/USDT", realSpot, syntheticFuture.price);
+    dispatcher->stop();
 
-    double spread = syntheticSpot.price - realSpot;
-    StatisticalArbitrageEngine::updateSpreadHistory("BTC_SPOT_SYNTH", spread);
-    if (StatisticalArbitrageEngine::isMeanReversionSignal("BTC_SPOT_SYNTH", spread, 2.0))
+    // Windows ends the process as soon as a close event handler returns
+    if (event == CTRL_CLOSE_EVENT)
     {
-        std::cout << "📈 Stat-Arb Signal: Spread deviation detected (Z-Score ≥ 2)\n";
+        for (int i = 0; i < 50 && !shutdownComplete.load(); ++i)
+            Sleep(100);
     }
-
-    double capital1 = ArbitrageLegOptimizer::computeCapitalLimit(okxSpot, binancePerp, 10000.0);
-    double capital2 = ArbitrageLegOptimizer::computeCapitalLimit(okxSpot, okxSpot, 10000.0);
-
-    ArbitrageOpportunity arb1 = SyntheticInstrumentCalculator::evaluateArbitrage("BTC/USDT", "OKX", "Binance", realSpot, syntheticSpot.price, 0.1, capital1, okxSpot, binancePerp);
-    ArbitrageOpportunity arb2 = SyntheticInstrumentCalculator::evaluateArbitrage("BTC/USDT", "OKX", "OKX", realSpot, syntheticFuture.price, 0.1, capital2, okxSpot, binancePerp);
-
-    if (!arb1.longExchange.empty() && RiskManager::isRiskAcceptable(arb1, okxSpot)) {
-        arb1.strategyType = "Spot vs Synthetic Spot";
-        std::cout << arb1.describe();
-        TradeExecutor::executeTrade(arb1);
-    }
-
-    if (!arb2.longExchange.empty() && RiskManager::isRiskAcceptable(arb2, okxSpot)) {
-        arb2.strategyType = "Spot vs Synthetic Future";
-        std::cout << arb2.describe();
-        TradeExecutor::executeTrade(arb2);
-    }
-
-    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+    return TRUE;
 }
 
-void checkCrossExchangeSpotArb(MarketDataAggregator &aggregator)
+int main(int argc, char **argv)
 {
-    const auto &latestUpdates = aggregator.getLatestUpdates();
-    if (!latestUpdates.count("Binance") || !latestUpdates.count("Bybit"))
-        return;
-
-    std::cout << "\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
-    std::cout << "🔍 CROSS-EXCHANGE SPOT ARBITRAGE\n";
-    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
-
-    const auto &binanceReal = latestUpdates.at("Binance");
-    const auto &bybitReal = latestUpdates.at("Bybit");
-
-    double binanceMid = (binanceReal.bestBid + binanceReal.bestAsk) / 2.0;
-    double bybitMid = (bybitReal.bestBid + bybitReal.bestAsk) / 2.0;
-
-    CorrelationAnalyzer::updatePrice("BTC_BINANCE", binanceMid);
-    CorrelationAnalyzer::updatePrice("BTC_BYBIT", bybitMid);
-    CorrelationAnalyzer::displayAlertIfDiverging("BTC_BINANCE", "BTC_BYBIT");
-
-    double mispricing = SyntheticInstrumentCalculator::computeMispricing(bybitMid, binanceMid);
-    std::cout << "≡ Cross-Exchange Mispricing (Binance vs Bybit): " << mispricing << "%\n";
-
-    double capital = ArbitrageLegOptimizer::computeCapitalLimit(bybitReal, binanceReal, 10000.0);
-    ArbitrageOpportunity arb = SyntheticInstrumentCalculator::evaluateArbitrage("BTC/USDT", "Bybit", "Binance", bybitMid, binanceMid, 0.1, capital, bybitReal, binanceReal);
+    SetConsoleOutputCP(CP_UTF8);
 
-    if (!arb.longExchange.empty() && RiskManager::isRiskAcceptable(arb, bybitReal)) {
-        arb.strategyType = "Cross-Exchange Spot Arbitrage";
-        std::cout << arb.describe();
-        TradeExecutor::executeTrade(arb);
+    // --record <path>:     capture every raw frame into a memory-mapped journal
+    // --endpoint <wss-url>: point every client at another host (mock_exchange)
+    // --stale <venue>=<ms>: staleness limit for a venue's quotes (default 2000)
+    // --vip <venue>=<tier>: the account's fee tier on a venue (default 0)
+    std::string recordPath;
+    std::string endpoint;
+    std::vector<std::string> staleLimits;
+    std::vector<std::string> vipTiers;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+            recordPath = argv[++i];
+        else if (std::strcmp(argv[i], "--endpoint") == 0 && i + 1 < argc)
+            endpoint = argv[++i];
+        else if (std::strcmp(argv[i], "--stale") == 0 && i + 1 < argc)
+            staleLimits.push_back(argv[++i]);
+        else if (std::strcmp(argv[i], "--vip") == 0 && i + 1 < argc)
+            vipTiers.push_back(argv[++i]);
     }
 
-    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
-}
-
-
-void checkSyntheticVsRealSpot(MarketDataAggregator &aggregator)
-{
-    const auto &latestUpdates = aggregator.getLatestUpdates();
-    if (!latestUpdates.count("Binance") || !latestUpdates.count("Bybit"))
-        return;
-
-    std::cout << "\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
-    std::cout << "🔍 SYNTHETIC VS REAL SPOT (BINANCE vs BYBIT)\n";
-    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
-
-    const auto &binancePerp = latestUpdates.at("Binance");
-    const auto &bybitSpot = latestUpdates.at("Bybit");
-
-    RiskDashboard::displayLiquidityAlert("BTC/USDT", bybitSpot, 2.0);
-    RiskDashboard::displayLiquidityAlert("BTC/USDT", binancePerp, 2.0);
-
-    SyntheticInstrument binanceSynthetic = SyntheticInstrumentCalculator::computeSyntheticSpot(binancePerp, 0.0005, 2.0);
-    double realBybit = (bybitSpot.bestBid + bybitSpot.bestAsk) / 2.0;
-
-    double mispricing = SyntheticInstrumentCalculator::computeMispricing(realBybit, binanceSynthetic.price);
-    std::cout << "≡ Mispricing (Synthetic Spot vs Real Spot): " << mispricing << "%\n";
-
-    double capital = ArbitrageLegOptimizer::computeCapitalLimit(bybitSpot, binancePerp, 10000.0);
-    ArbitrageOpportunity arb = SyntheticInstrumentCalculator::evaluateArbitrage("BTC/USDT", "Bybit", "Binance", realBybit, binanceSynthetic.price, 0.1, capital, bybitSpot, binancePerp);
-
-    if (!arb.longExchange.empty() && RiskManager::isRiskAcceptable(arb, bybitSpot)) {
-        arb.strategyType = "Synthetic Spot vs Real Spot";
-        std::cout << arb.describe();
-        TradeExecutor::executeTrade(arb);
+    // Declared first so it is destroyed last: the clients' sockets belong to
+    // its io_contexts. Its threads run client handlers, so it is stopped
+    // explicitly before anything those handlers touch goes away (see the end).
+    std::unique_ptr<TransportManager> transport;
+    if (SHARED_TRANSPORT_THREADS > 0) {
+        transport = std::make_unique<TransportManager>(SHARED_TRANSPORT_THREADS);
     }
 
-    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
-}
-
-void runStressTest(MarketDataAggregator &aggregator)
-{
-    const auto &latestUpdates = aggregator.getLatestUpdates();
-    if (!latestUpdates.count("Binance"))
-        return;
-
-    std::cout << "\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
-    std::cout << "🧪 STRESS TEST - PRICE SHOCK SIMULATION\n";
-    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
-
-    const auto &binance = latestUpdates.at("Binance");
-    OrderBookUpdate shockedBook = StressTester::simulatePriceShock(binance, -20.0);
-
-    std::cout << "⚠️ Simulated -20% Price Shock on Binance\n";
-    std::cout << "Old Bid: " << binance.bestBid << " | New Bid: " << shockedBook.bestBid << "\n";
+    // Also declared before the clients: their handlers write into it
+    std::unique_ptr<FeedJournalWriter> journal;
+    if (!recordPath.empty()) {
+        journal = std::make_unique<FeedJournalWriter>(recordPath);
+        if (!journal->isOpen()) journal.reset();
+    }
 
-    SyntheticInstrument synthetic = SyntheticInstrumentCalculator::computeSyntheticSpot(shockedBook, 0.0005, 2.0);
-    std::cout << "📉 Synthetic Spot Price After Shock: " << synthetic.price << "\n";
+    MarketDataAggregator aggregator;
+    aggregator.enableDepth(primaryInstrument()); // liquidity checks walk the book
+
+    // Strategies run as soon as an update they depend on lands in the aggregator
+    StrategyDispatcher dispatcher;
+    ConsolidatedBook consolidated;
+    TickHistory tickHistory;
+    QuoteFreshness freshness;
+    SyntheticGraph synthetics;
+    CrossVenueScanner scanner(freshness, MIN_NET_EDGE_BPS);
+    CurrencyCycleDetector cycles(freshness, MIN_NET_EDGE_BPS);
+    FeeSchedule fees;
+    fees.loadDefaults();
+    defineSynthetics(synthetics, fees);
+    const MarketState state{aggregator, consolidated, tickHistory, freshness, synthetics, scanner, cycles, fees};
+    connectStrategies(dispatcher, state);
 
-    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
-}
+    std::vector<std::unique_ptr<ExchangeClient>> clients;
 
+    clients.emplace_back(std::make_unique<BinanceClient>(venueSymbols("", true, true)));
+    clients.emplace_back(std::make_unique<OKXClient>(venueSymbols("-", false, true), "books"));
+    clients.emplace_back(std::make_unique<BybitClient>(venueSymbols("", false, false), 50));
 
-int main()
-{
-    SetConsoleOutputCP(CP_UTF8);
+    // All registry ids exist before the first socket opens; feed threads only index with them
+    for (auto &client : clients)
+        InstrumentRegistry::registerVenue(client->name());
+    const VenueId binanceVenue = InstrumentRegistry::venueId("Binance");
+    const InstrumentId primary = primaryInstrument();
 
-    MarketDataAggregator aggregator;
-    std::vector<std::unique_ptr<ExchangeClient>> clients;
+    for (const auto &entry : staleLimits)
+    {
+        const auto eq = entry.find('=');
+        const VenueId venue = eq == std::string::npos ? InstrumentRegistry::NOT_FOUND : InstrumentRegistry::venueId(entry.substr(0, eq));
+        if (venue == InstrumentRegistry::NOT_FOUND)
+        {
+            std::cerr << "❌ --stale expects <venue>=<ms> for a known venue, got " << entry << std::endl;
+            continue;
+        }
+        freshness.setLimit(venue, std::chrono::milliseconds(std::atoi(entry.c_str() + eq + 1)));
+    }
 
-    clients.emplace_back(std::make_unique<BinanceClient>("btcusdt"));
-    clients.emplace_back(std::make_unique<OKXClient>("BTC-USDT"));
-    clients.emplace_back(std::make_unique<BybitClient>("BTCUSDT"));
+    for (const auto &entry : vipTiers)
+    {
+        const auto eq = entry.find('=');
+        const VenueId venue = eq == std::string::npos ? InstrumentRegistry::NOT_FOUND : InstrumentRegistry::venueId(entry.substr(0, eq));
+        if (venue == InstrumentRegistry::NOT_FOUND)
+        {
+            std::cerr << "❌ --vip expects <venue>=<tier> for a known venue, got " << entry << std::endl;
+            continue;
+        }
+        fees.setTier(venue, std::atoi(entry.c_str() + eq + 1));
+    }
+    applyFees(fees, scanner, cycles);
+    fees.print();
+
+    // Feed threads publish normalized updates on the bus, one ring per client.
+    // "Market State" runs on the dispatcher thread before each pass; "Risk"
+    // runs on its own thread and only sees an update once the state has it.
+    MarketDataBus bus;
+    std::vector<int> latencyVenues(InstrumentRegistry::MAX_VENUES, -1);
+    for (auto &client : clients)
+    {
+        bus.addVenue(client->name());
+        latencyVenues[InstrumentRegistry::venueId(client->name())] = LatencyMonitor::registerVenue(client->name());
+    }
+    const int stateConsumer = bus.addConsumer("Market State", [&latencyVenues, &state, &dispatcher](const TopOfBook &top) {
+        LatencyMonitor::recordUpdate(latencyVenues[top.venue], top);
+        applyMarketUpdate(state, dispatcher, top);
+    });
+    const int riskConsumer = bus.addConsumer("Risk", [lastMid = std::vector<double>(InstrumentRegistry::MAX_VENUES * InstrumentRegistry::MAX_INSTRUMENTS, 0.0)](const TopOfBook &top) mutable {
+        constexpr double JUMP_THRESHOLD = 0.01;
+        if (top.instrument < 0 || top.bestBid <= 0 || top.bestAsk <= 0)
+            return;
+        double &previous = lastMid[top.venue * InstrumentRegistry::MAX_INSTRUMENTS + top.instrument];
+        const double mid = top.mid();
+        if (previous > 0 && std::abs(mid - previous) / previous > JUMP_THRESHOLD)
+            RiskDashboard::displayPriceJump(InstrumentRegistry::venueName(top.venue),
+                                            InstrumentRegistry::instrumentName(top.instrument), previous, mid);
+        previous = mid;
+    }, {stateConsumer});
+    bus.setWakeHandler([&dispatcher] { dispatcher.wake(); });
+    dispatcher.addSource([&bus, stateConsumer]() { return bus.poll(stateConsumer); });
+    bus.start(riskConsumer, WaitStrategy::Block);
 
     auto binancePerp = std::make_unique<BinancePerpClient>("btcusdt");
-    binancePerp->setMarkPriceCallback([&aggregator](double mark, double funding) {
-        aggregator.updateFundingAndMark("Binance", mark, funding);
+    binancePerp->watchSymbols(venueSymbols("", false, false));
+    const int perpVenue = LatencyMonitor::registerVenue(binancePerp->name());
+    binancePerp->setMarkPriceBatchCallback([&aggregator, perpVenue, binanceVenue, perp = binancePerp.get()](const std::vector<MarkPriceEntry> &entries) {
+        for (const auto &e : entries)
+        {
+            LatencyMonitor::recordExchangeToReceive(perpVenue, Timestamp(std::chrono::milliseconds(e.eventTime)),
+                                                    perp->lastReceiveTime().wall);
+            aggregator.updateFunding(binanceVenue, perp->instrumentId(e.symbolId),
+                                     {e.markPrice, e.fundingRate, e.indexPrice, e.nextFundingTime});
+        }
     });
+    if (transport) binancePerp->useTransport(*transport);
+    binancePerp->setJournal(journal.get());
+    if (!endpoint.empty()) binancePerp->setEndpoint(endpoint);
     binancePerp->connect();
 
-    for (auto &client : clients)
+    for (size_t feed = 0; feed < clients.size(); ++feed)
     {
-        client->setOrderBookCallback([&aggregator, &client](const OrderBookUpdate &update) {
-            aggregator.update(client->name(), update);
+        auto &client = clients[feed];
+        const VenueId venueId = InstrumentRegistry::venueId(client->name());
+        client->setOrderBookCallback([&aggregator, &bus, feed = static_cast<int>(feed), venueId](const OrderBookUpdate &update) {
+            // The depth view is a seqlock write, so it stays on the feed thread
+            aggregator.updateBook(venueId, update);
+            bus.publish(feed, TopOfBook::from(venueId, update));
         });
+        if (transport) client->useTransport(*transport);
+        client->setJournal(journal.get());
+        if (!endpoint.empty()) client->setEndpoint(endpoint);
         client->connect();
-        std::this_thread::sleep_for(std::chrono::seconds(2));
+        // Shared loops only start below, with every connection already queued
+        if (!transport)
+            std::this_thread::sleep_for(std::chrono::seconds(2));
     }
 
-    int loopCount = 0;
-    while (true)
-    {
-        PerformanceMonitor::startLatencyTimer();
-
-        checkSyntheticFutures(aggregator);
-        checkCrossExchangeSpotArb(aggregator);
-        checkSyntheticVsRealSpot(aggregator);
-        VolatilityArbitrage::checkVolatilityArbitrage(aggregator);
+    if (transport) {
+        transport->start();
+        transport->printAssignments();
+    }
 
+    // Snapshot and reports keep their old cadence, on the dispatcher thread
+    MarketSnapshot marketSnapshot;
+    dispatcher.addPeriodic("Market Snapshot", std::chrono::seconds(2), [&aggregator, &marketSnapshot, &synthetics, primary]() {
+        aggregator.refresh(marketSnapshot);
         std::cout << "\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
         std::cout << "📸 MARKET SNAPSHOT\n";
         std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
-        aggregator.printSnapshot();
+        aggregator.printSnapshot(primary);
+        synthetics.print(primary);
+        std::cout << "🔄 " << marketSnapshot.changed().size() << " venue/instrument quotes changed since the last snapshot\n";
+    });
 
-        PerformanceMonitor::recordUpdate();
-        PerformanceMonitor::stopLatencyTimer();
+    dispatcher.addPeriodic("Reports", std::chrono::seconds(20), [&aggregator, &dispatcher, &bus, &synthetics, &cycles, &journal]() {
+        runStressTest(aggregator);
+        VaREstimator::printVaRReport();
+        PerformanceMonitor::printMetrics();
+        LatencyMonitor::printReport();
+        SequenceMonitor::printReport();
+        bus.printStats();
+        dispatcher.printStats();
+        synthetics.printStats();
+        cycles.printStats();
+        TradeExecutor::printPnLSummary();
+        TradeExecutor::writeTradeHistoryToCSV("executed_trades.csv");
+        if (journal)
+            journal->printStats();
+    });
 
-        std::this_thread::sleep_for(std::chrono::seconds(2));
+    runningDispatcher.store(&dispatcher);
+    SetConsoleCtrlHandler(onConsoleControl, TRUE);
 
-        if (++loopCount % 10 == 0)
-        {
-            runStressTest(aggregator);
-            VaREstimator::printVaRReport();
-            PerformanceMonitor::printMetrics();
-            TradeExecutor::printPnLSummary();
-            TradeExecutor::writeTradeHistoryToCSV("executed_trades.csv");
-        }
-    }
+    dispatcher.run();
+    std::cout << "🛑 Shutting down\n";
+
+    // No handler may run while the bus, the aggregator or the clients are torn down
+    if (transport)
+        transport->stop();
+    else
+        for (auto &client : clients)
+            client->disconnect();
+
+    // Feed handlers have stopped appending; trim the journal to what was written
+    if (journal)
+        journal->close();
 
+    runningDispatcher.store(nullptr);
+    shutdownComplete.store(true);
     return 0;
 }
 
@@ -0,0 +1,155 @@
+#include "LatencyMonitor.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+// ---------------------------------------------------------------------------
+// LatencyHistogram
+// ---------------------------------------------------------------------------
+
+int LatencyHistogram::bucketFor(uint64_t value) {
+    if (value < SUB_BUCKETS) return static_cast<int>(value);
+
+    int exponent = std::bit_width(value) - 1; // >= SUB_BITS
+    if (exponent > MAX_EXPONENT) return BUCKETS - 1;
+
+    int sub = static_cast<int>((value >> (exponent - SUB_BITS)) & (SUB_BUCKETS - 1));
+    return (exponent - SUB_BITS + 1) * SUB_BUCKETS + sub;
+}
+
+int64_t LatencyHistogram::bucketValue(int index) {
+    if (index < SUB_BUCKETS) return index;
+
+    int exponent = index / SUB_BUCKETS + SUB_BITS - 1;
+    int64_t sub = index % SUB_BUCKETS;
+    int64_t lower = (SUB_BUCKETS + sub) << (exponent - SUB_BITS);
+    int64_t width = int64_t{1} << (exponent - SUB_BITS);
+    return lower + width / 2;
+}
+
+void LatencyHistogram::record(int64_t nanos) {
+    if (nanos < 0) {
+        negative.fetch_add(1, std::memory_order_relaxed);
+        nanos = 0;
+    }
+
+    buckets[bucketFor(static_cast<uint64_t>(nanos))].fetch_add(1, std::memory_order_relaxed);
+    total.fetch_add(1, std::memory_order_relaxed);
+
+    int64_t seen = maxValue.load(std::memory_order_relaxed);
+    while (nanos > seen && !maxValue.compare_exchange_weak(seen, nanos, std::memory_order_relaxed)) {
+    }
+}
+
+int64_t LatencyHistogram::percentileNanos(double p) const {
+    uint64_t n = count();
+    if (n == 0) return 0;
+
+    uint64_t target = static_cast<uint64_t>(std::ceil(std::clamp(p, 0.0, 100.0) / 100.0 * n));
+    target = std::max<uint64_t>(target, 1);
+
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKETS; ++i) {
+        seen += buckets[i].load(std::memory_order_relaxed);
+        if (seen >= target) return std::min(bucketValue(i), maxNanos());
+    }
+    return maxNanos();
+}
+
+void LatencyHistogram::reset() {
+    for (auto& bucket : buckets) bucket.store(0, std::memory_order_relaxed);
+    total.store(0, std::memory_order_relaxed);
+    negative.store(0, std::memory_order_relaxed);
+    maxValue.store(0, std::memory_order_relaxed);
+}
+
+// ---------------------------------------------------------------------------
+// LatencyMonitor
+// ---------------------------------------------------------------------------
+
+std::array<LatencyMonitor::VenueLatency, LatencyMonitor::MAX_VENUES> LatencyMonitor::venues;
+std::atomic<int> LatencyMonitor::venueCount{0};
+
+int LatencyMonitor::registerVenue(const std::string& venue) {
+    int id = venueId(venue);
+    if (id >= 0) return id;
+
+    id = venueCount.load(std::memory_order_relaxed);
+    if (id >= MAX_VENUES) {
+        std::cerr << "❌ LatencyMonitor: too many venues, ignoring " << venue << std::endl;
+        return -1;
+    }
+    venues[id].name = venue;
+    venueCount.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+int LatencyMonitor::venueId(const std::string& venue) {
+    int count = venueCount.load(std::memory_order_acquire);
+    for (int i = 0; i < count; ++i) {
+        if (venues[i].name == venue) return i;
+    }
+    return -1;
+}
+
+LatencyHistogram& LatencyMonitor::histogram(int venue, Stage stage) {
+    auto& v = venues[venue];
+    return stage == Stage::ExchangeToReceive ? v.exchangeToReceive : v.receiveToDispatch;
+}
+
+void LatencyMonitor::record(int venue, Stage stage, int64_t nanos) {
+    if (venue < 0 || venue >= MAX_VENUES) return;
+    histogram(venue, stage).record(nanos);
+}
+
+void LatencyMonitor::recordExchangeToReceive(int venue, Timestamp exchangeTime, Timestamp receiveTime) {
+    if (exchangeTime == Timestamp{}) return; // venue sent no event time
+    record(venue, Stage::ExchangeToReceive,
+           std::chrono::duration_cast<std::chrono::nanoseconds>(receiveTime - exchangeTime).count());
+}
+
+void LatencyMonitor::recordUpdate(int venue, const TopOfBook& update) {
+    recordExchangeToReceive(venue, update.exchangeTime, update.timestamp);
+    if (update.receiveTime != MonoTimestamp{}) {
+        record(venue, Stage::ReceiveToDispatch,
+               std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - update.receiveTime).count());
+    }
+}
+
+double LatencyMonitor::percentileMicros(int venue, Stage stage, double p) {
+    if (venue < 0 || venue >= MAX_VENUES) return 0.0;
+    return histogram(venue, stage).percentileNanos(p) / 1000.0;
+}
+
+uint64_t LatencyMonitor::sampleCount(int venue, Stage stage) {
+    if (venue < 0 || venue >= MAX_VENUES) return 0;
+    return histogram(venue, stage).count();
+}
+
+void LatencyMonitor::printReport() {
+    auto printRow = [](const std::string& venue, const char* stage, LatencyHistogram& h) {
+        if (h.count() == 0) return;
+        std::cout << "   ➤ " << std::left << std::setw(12) << venue << std::setw(14) << stage << std::right
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(10) << h.percentileNanos(50) / 1000.0
+                  << std::setw(10) << h.percentileNanos(90) / 1000.0
+                  << std::setw(10) << h.percentileNanos(99) / 1000.0
+                  << std::setw(10) << h.percentileNanos(99.9) / 1000.0
+                  << std::setw(10) << h.maxNanos() / 1000.0
+                  << std::setw(10) << h.count();
+        if (h.negativeCount()) std::cout << "  (" << h.negativeCount() << " negative: clock skew)";
+        std::cout << "\n";
+        h.reset();
+    };
+
+    std::cout << "⏱️ Venue Latency (µs)" << std::string(19, ' ')
+              << "     p50       p90       p99     p99.9       max   samples\n";
+
+    int count = venueCount.load(std::memory_order_acquire);
+    for (int i = 0; i < count; ++i) {
+        printRow(venues[i].name, "exch→recv", venues[i].exchangeToReceive);
+        printRow(venues[i].name, "recv→dispatch", venues[i].receiveToDispatch);
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include "exchange/MarketDataTypes.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// Lock-free log-linear latency histogram (nanosecond samples, ~3% bucket
+// resolution up to ~18 minutes). record() is a couple of relaxed atomic
+// increments, so feed threads can call it on every update.
+class LatencyHistogram {
+public:
+    void record(int64_t nanos);
+
+    uint64_t count() const { return total.load(std::memory_order_relaxed); }
+    uint64_t negativeCount() const { return negative.load(std::memory_order_relaxed); }
+    int64_t maxNanos() const { return maxValue.load(std::memory_order_relaxed); }
+
+    // p in [0, 100]. Negative samples count as 0. Returns 0 with no samples.
+    int64_t percentileNanos(double p) const;
+
+    void reset();
+
+private:
+    static constexpr int SUB_BITS = 5;
+    static constexpr int SUB_BUCKETS = 1 << SUB_BITS;
+    static constexpr int MAX_EXPONENT = 40;
+    static constexpr int BUCKETS = (MAX_EXPONENT - SUB_BITS + 2) * SUB_BUCKETS;
+
+    static int bucketFor(uint64_t value);
+    static int64_t bucketValue(int index);
+
+    std::array<std::atomic<uint64_t>, BUCKETS> buckets{};
+    std::atomic<uint64_t> total{0};
+    std::atomic<uint64_t> negative{0};
+    std::atomic<int64_t> maxValue{0};
+};
+
+// Per-venue one-way latency, used to judge how far behind each venue's
+// quotes are when comparing them across venues.
+//
+//   ExchangeToReceive: local receive wall time - venue event time. Wall
+//                      clocks on both ends, so it includes our clock offset
+//                      to the venue and may be negative.
+//   ReceiveToDispatch: monotonic time from the frame leaving the socket to
+//                      the update reaching the strategy side.
+class LatencyMonitor {
+public:
+    enum class Stage { ExchangeToReceive, ReceiveToDispatch };
+    static constexpr int MAX_VENUES = 8;
+
+    // Returns the venue's id, registering it on first use. Register all
+    // venues at startup, before feed threads start recording.
+    static int registerVenue(const std::string& venue);
+    static int venueId(const std::string& venue); // -1 if unknown
+
+    // Both stages for an update being dispatched now.
+    static void recordUpdate(int venue, const TopOfBook& update);
+    static void recordExchangeToReceive(int venue, Timestamp exchangeTime, Timestamp receiveTime);
+    static void record(int venue, Stage stage, int64_t nanos);
+
+    static double percentileMicros(int venue, Stage stage, double p);
+    static uint64_t sampleCount(int venue, Stage stage);
+
+    // p50/p90/p99/p99.9/max per venue and stage, then starts a new window.
+    static void printReport();
+
+private:
+    struct VenueLatency {
+        std::string name;
+        LatencyHistogram exchangeToReceive;
+        LatencyHistogram receiveToDispatch;
+    };
+
+    static LatencyHistogram& histogram(int venue, Stage stage);
+
+    static std::array<VenueLatency, MAX_VENUES> venues;
+    static std::atomic<int> venueCount;
+};
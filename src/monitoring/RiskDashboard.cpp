@@ -10,7 +10,7 @@ void RiskDashboard::displayFundingImpact(const std::string& symbol, double fundi
               << " → Cost: " << std::fixed << std::setprecision(2) << impact << " USDT\n";
 }
 
-void RiskDashboard::displayLiquidityAlert(const std::string& symbol, const OrderBookUpdate& book, double requiredQty) {
+void RiskDashboard::displayLiquidityAlert(const std::string& symbol, const TopOfBook& book, double requiredQty) {
     if (book.bestBidQty < requiredQty || book.bestAskQty < requiredQty) {
         std::cout << "⚠️ Liquidity Warning for " << symbol << ": Insufficient depth for "
                   << requiredQty << " units.\n";
@@ -24,3 +24,10 @@ void RiskDashboard::displayBasisRisk(const std::string& symbol, double realPrice
               << std::fixed << std::setprecision(2)
               << basis << " USDT (" << basisPct << "%)\n";
 }
+
+void RiskDashboard::displayPriceJump(const std::string& venue, const std::string& symbol, double previousMid, double mid) {
+    double jumpPct = (mid - previousMid) / previousMid * 100.0;
+    std::cout << "⚠️ Price Jump [" << venue << " " << symbol << "]: "
+              << std::fixed << std::setprecision(2)
+              << previousMid << " → " << mid << " (" << jumpPct << "%)\n";
+}
@@ -5,6 +5,7 @@
 class RiskDashboard {
 public:
     static void displayFundingImpact(const std::string& symbol, double fundingRate, double capital);
-    static void displayLiquidityAlert(const std::string& symbol, const OrderBookUpdate& book, double requiredQty);
+    static void displayLiquidityAlert(const std::string& symbol, const TopOfBook& book, double requiredQty);
     static void displayBasisRisk(const std::string& symbol, double realPrice, double syntheticPrice);
+    static void displayPriceJump(const std::string& venue, const std::string& symbol, double previousMid, double mid);
 };
@@ -0,0 +1,63 @@
+#include "SequenceMonitor.hpp"
+#include <iomanip>
+#include <iostream>
+
+std::array<SequenceMonitor::VenueSequencing, InstrumentRegistry::MAX_VENUES> SequenceMonitor::venues;
+
+SequenceMonitor::VenueSequencing* SequenceMonitor::venue(VenueId id) {
+    if (id < 0 || id >= InstrumentRegistry::MAX_VENUES) return nullptr;
+    return &venues[id];
+}
+
+void SequenceMonitor::recordGap(VenueId id) {
+    if (auto* v = venue(id)) v->gaps.fetch_add(1, std::memory_order_relaxed);
+}
+
+void SequenceMonitor::recordDropped(VenueId id) {
+    if (auto* v = venue(id)) v->dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+void SequenceMonitor::recordResyncRequest(VenueId id) {
+    if (auto* v = venue(id)) v->resyncRequests.fetch_add(1, std::memory_order_relaxed);
+}
+
+void SequenceMonitor::recordResync(VenueId id, int64_t nanos) {
+    if (auto* v = venue(id)) v->resyncLatency.record(nanos);
+}
+
+void SequenceMonitor::addPending(VenueId id, int delta) {
+    if (auto* v = venue(id)) v->pending.fetch_add(delta, std::memory_order_relaxed);
+}
+
+uint64_t SequenceMonitor::gapCount(VenueId id) {
+    auto* v = venue(id);
+    return v ? v->gaps.load(std::memory_order_relaxed) : 0;
+}
+
+void SequenceMonitor::printReport() {
+    const int count = InstrumentRegistry::venueCount();
+    bool header = false;
+
+    for (int i = 0; i < count; ++i) {
+        auto& v = venues[i];
+        const uint64_t gaps = v.gaps.load(std::memory_order_relaxed);
+        const uint64_t dropped = v.dropped.load(std::memory_order_relaxed);
+        if (gaps == 0 && dropped == 0) continue;
+
+        if (!header) {
+            std::cout << "🧩 Feed Sequencing" << std::string(6, ' ')
+                      << "gaps   dropped   resyncs   pending   resync p50 ms   max ms\n";
+            header = true;
+        }
+        std::cout << "   ➤ " << std::left << std::setw(12) << InstrumentRegistry::venueName(i) << std::right
+                  << std::setw(9) << gaps
+                  << std::setw(10) << dropped
+                  << std::setw(10) << v.resyncRequests.load(std::memory_order_relaxed)
+                  << std::setw(10) << v.pending.load(std::memory_order_relaxed)
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(16) << v.resyncLatency.percentileNanos(50) / 1e6
+                  << std::setw(9) << v.resyncLatency.maxNanos() / 1e6 << "\n";
+    }
+
+    if (!header) std::cout << "🧩 Feed Sequencing: no gaps\n";
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "monitoring/LatencyMonitor.hpp"
+#include "exchange/InstrumentRegistry.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// Per-venue feed continuity metrics, written by the feed threads and read by
+// the reports. Indexed by InstrumentRegistry venue id.
+//
+//   gaps:     sequence breaks and checksum mismatches that invalidated a book
+//   dropped:  out-of-order or duplicate updates discarded
+//   resyncs:  snapshot requests sent (first attempts and retries)
+//   pending:  instruments currently waiting for a fresh snapshot
+//   resync latency: from detecting the gap to applying the new snapshot
+class SequenceMonitor {
+public:
+    static void recordGap(VenueId venue);
+    static void recordDropped(VenueId venue);
+    static void recordResyncRequest(VenueId venue);
+    static void recordResync(VenueId venue, int64_t nanos);
+    static void addPending(VenueId venue, int delta);
+
+    static uint64_t gapCount(VenueId venue);
+
+    // Counts are cumulative; only venues that saw a gap or drop are listed.
+    static void printReport();
+
+private:
+    struct VenueSequencing {
+        std::atomic<uint64_t> gaps{0};
+        std::atomic<uint64_t> dropped{0};
+        std::atomic<uint64_t> resyncRequests{0};
+        std::atomic<int> pending{0};
+        LatencyHistogram resyncLatency;
+    };
+
+    static VenueSequencing* venue(VenueId id);
+
+    static std::array<VenueSequencing, InstrumentRegistry::MAX_VENUES> venues;
+};
@@ -1,9 +1,11 @@
 #include "monitoring/StressTester.hpp"
 
-OrderBookUpdate StressTester::simulatePriceShock(const OrderBookUpdate& original, double shockPercent) {
+TopOfBook StressTester::simulatePriceShock(const TopOfBook& original, double shockPercent) {
     double factor = 1.0 + (shockPercent / 100.0);  // e.g., -20% = 0.8
-    OrderBookUpdate shocked = original;
+    TopOfBook shocked = original;
     shocked.bestBid *= factor;
     shocked.bestAsk *= factor;
+    for (auto& level : shocked.nextBids) level.price *= factor;
+    for (auto& level : shocked.nextAsks) level.price *= factor;
     return shocked;
 }
@@ -3,5 +3,5 @@
 
 class StressTester {
 public:
-    static OrderBookUpdate simulatePriceShock(const OrderBookUpdate& original, double shockPercent);
+    static TopOfBook simulatePriceShock(const TopOfBook& original, double shockPercent);
 };
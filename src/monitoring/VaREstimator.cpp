@@ -2,17 +2,14 @@
 #include <iomanip>
 
 void VaREstimator::addPnL(double pnl) {
-    pnlHistory.push_back(pnl);
-    if (pnlHistory.size() > MAX_HISTORY) {
-        pnlHistory.erase(pnlHistory.begin());
-    }
+    pnlHistory.push(pnl);
 }
 
 double VaREstimator::computeHistoricalVaR(double confidenceLevel) {
     if (pnlHistory.empty()) return 0.0;
 
     std::vector<double> losses;
-    for (double pnl : pnlHistory) {
+    for (double pnl : pnlHistory.last(MAX_HISTORY)) {
         if (pnl < 0) losses.push_back(-pnl); // treat as loss
     }
 
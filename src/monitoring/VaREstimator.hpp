@@ -1,4 +1,5 @@
 #pragma once
+#include "exchange/HistoryRing.hpp"
 #include <vector>
 #include <algorithm>
 #include <iostream>
@@ -10,6 +11,6 @@ public:
     static void printVaRReport();
 
 private:
-    static inline std::vector<double> pnlHistory = {};
     static constexpr size_t MAX_HISTORY = 1000; // limit memory usage
+    static inline HistoryRing<double> pnlHistory{MAX_HISTORY};
 };
@@ -0,0 +1,109 @@
+#include "TestCheck.hpp"
+#include "exchange/ConsolidatedBook.hpp"
+#include <vector>
+
+namespace {
+    TopOfBook quote(VenueId venue, InstrumentId instrument, double bid, double ask) {
+        TopOfBook top{};
+        top.venue = static_cast<int16_t>(venue);
+        top.instrument = instrument;
+        top.bestBid = bid;
+        top.bestAsk = ask;
+        top.bestBidQty = 1.0;
+        top.bestAskQty = 1.0;
+        return top;
+    }
+}
+
+static void sidesStayBestFirst() {
+    const VenueId a = InstrumentRegistry::registerVenue("A");
+    const VenueId b = InstrumentRegistry::registerVenue("B");
+    const VenueId c = InstrumentRegistry::registerVenue("C");
+    const InstrumentId eth = InstrumentRegistry::registerInstrument("ETHUSDT");
+
+    ConsolidatedBook book;
+    book.update(quote(a, eth, 100.0, 102.0));
+    book.update(quote(b, eth, 101.0, 103.0));
+    book.update(quote(c, eth, 100.0, 101.5));
+
+    CHECK(book.bids(eth).size() == 3);
+    CHECK(book.bids(eth)[0].venue == b);
+    CHECK(book.bids(eth)[1].venue == a); // tie: the earlier quote keeps priority
+    CHECK(book.asks(eth)[0].venue == c);
+    CHECK(book.asks(eth)[2].venue == b);
+
+    // A venue's new quote replaces its old one
+    book.update(quote(b, eth, 99.0, 104.0));
+    CHECK(book.bids(eth).size() == 3);
+    CHECK(book.bids(eth)[2].venue == b);
+}
+
+static void crossesAreEdgeTriggered() {
+    const VenueId a = InstrumentRegistry::registerVenue("A");
+    const VenueId b = InstrumentRegistry::registerVenue("B");
+    const InstrumentId btc = InstrumentRegistry::registerInstrument("BTCUSDT");
+
+    ConsolidatedBook book;
+    std::vector<ConsolidatedBook::CrossEvent> events;
+    book.setCrossListener([&events](const ConsolidatedBook::CrossEvent& e) { events.push_back(e); });
+
+    book.update(quote(a, btc, 100.0, 101.0));
+    book.update(quote(b, btc, 100.5, 101.5));
+    CHECK(events.empty());
+    CHECK(!book.isCrossed(btc));
+
+    // B's bid above A's ask: crossed, sell on B and buy on A
+    book.update(quote(b, btc, 101.2, 102.0));
+    CHECK(events.size() == 1);
+    CHECK(book.isCrossed(btc));
+    if (!events.empty()) {
+        CHECK(events[0].instrument == btc);
+        CHECK(events[0].bid.venue == b && events[0].bid.price == 101.2);
+        CHECK(events[0].ask.venue == a && events[0].ask.price == 101.0);
+        CHECK(!events[0].locked);
+    }
+
+    // The same cross again is not a new event; a price change at the top is
+    book.update(quote(b, btc, 101.2, 102.0));
+    CHECK(events.size() == 1);
+    book.update(quote(b, btc, 101.3, 102.0));
+    CHECK(events.size() == 2);
+
+    // Uncrossing and crossing again at the same prices fires again
+    book.update(quote(a, btc, 100.0, 101.4));
+    CHECK(!book.isCrossed(btc));
+    book.update(quote(a, btc, 100.0, 101.0));
+    CHECK(events.size() == 3);
+
+    // Bid equal to ask is locked
+    book.update(quote(b, btc, 101.0, 102.0));
+    CHECK(events.size() == 4);
+    CHECK(!events.empty() && events.back().locked);
+
+    // Dropping a venue clears its cross without an event
+    book.removeVenue(b);
+    CHECK(!book.isCrossed(btc));
+    CHECK(book.bids(btc).size() == 1);
+    CHECK(events.size() == 4);
+    CHECK(book.crossEvents() == 4);
+}
+
+static void ownQuoteIsNotACross() {
+    const VenueId a = InstrumentRegistry::registerVenue("A");
+    const InstrumentId sol = InstrumentRegistry::registerInstrument("SOLUSDT");
+
+    ConsolidatedBook book;
+    int events = 0;
+    book.setCrossListener([&events](const ConsolidatedBook::CrossEvent&) { ++events; });
+
+    book.update(quote(a, sol, 10.5, 10.0));
+    CHECK(events == 0);
+    CHECK(!book.isCrossed(sol));
+}
+
+int main() {
+    sidesStayBestFirst();
+    crossesAreEdgeTriggered();
+    ownQuoteIsNotACross();
+    return testFailures();
+}
@@ -0,0 +1,93 @@
+#include "TestCheck.hpp"
+#include "arbitrage/DepthLadder.hpp"
+#include "arbitrage/SyntheticInstrumentCalculator.hpp"
+
+namespace {
+    constexpr double EPS = 1e-9;
+
+    // Asks 100 x1, 101 x2, 103 x5; bids 104 x1.5, 102 x1, 100 x4
+    DepthLadder asks() { return DepthLadder({{100.0, 1.0}, {101.0, 2.0}, {103.0, 5.0}}); }
+    DepthLadder bids() { return DepthLadder({{104.0, 1.5}, {102.0, 1.0}, {100.0, 4.0}}); }
+}
+
+static void ladderQueries() {
+    // Non-positive levels are skipped
+    const DepthLadder ladder({{100.0, 1.0}, {0.0, 3.0}, {101.0, 2.0}, {102.0, 0.0}, {103.0, 5.0}});
+    CHECK(ladder.levels() == 3);
+    CHECK_NEAR(ladder.totalQty(), 8.0, EPS);
+    CHECK_NEAR(ladder.totalNotional(), 100.0 + 202.0 + 515.0, EPS);
+
+    CHECK_NEAR(ladder.cost(0.0), 0.0, EPS);
+    CHECK_NEAR(ladder.cost(0.5), 50.0, EPS);
+    CHECK_NEAR(ladder.cost(1.0), 100.0, EPS);          // exactly the first level
+    CHECK_NEAR(ladder.cost(2.0), 201.0, EPS);          // into the second
+    CHECK_NEAR(ladder.cost(3.0), 302.0, EPS);          // through the second
+    CHECK_NEAR(ladder.cost(100.0), 817.0, EPS);        // more than the ladder holds
+    CHECK_NEAR(ladder.vwap(3.0), 302.0 / 3.0, EPS);
+    CHECK_NEAR(ladder.vwap(100.0), 817.0 / 8.0, EPS);
+
+    // The qty-th unit: a boundary belongs to the level it completes
+    CHECK(ladder.marginalPrice(1.0) == 100.0);
+    CHECK(ladder.marginalPrice(1.0 + 1e-9) == 101.0);
+    CHECK(ladder.marginalPrice(3.0) == 101.0);
+    CHECK(ladder.marginalPrice(100.0) == 103.0);
+
+    CHECK_NEAR(ladder.qtyFor(100.0), 1.0, EPS);
+    CHECK_NEAR(ladder.qtyFor(150.5), 1.5, EPS);
+    CHECK_NEAR(ladder.qtyFor(302.0), 3.0, EPS);
+    CHECK_NEAR(ladder.qtyFor(1e9), 8.0, EPS);
+
+    const DepthLadder empty;
+    CHECK(empty.levels() == 0);
+    CHECK(empty.vwap(1.0) == 0.0);
+    CHECK(empty.marginalPrice(1.0) == 0.0);
+}
+
+static void optimalSizeStopsAtTheLastClearingBoundary() {
+    // Units up to 1 clear 104 > 100, to 1.5 clear 104 > 101, to 2.5 clear
+    // 102 > 101; the next unit sells at 100 against 101
+    CHECK_NEAR(SyntheticInstrumentCalculator::optimalArbitrageSize(asks(), bids(), 0.0, 0.0), 2.5, EPS);
+
+    // 0.5% a leg: 102 * 0.995 no longer covers 101 * 1.005, so the bid boundary at 1.5 is the last
+    CHECK_NEAR(SyntheticInstrumentCalculator::optimalArbitrageSize(asks(), bids(), 0.005, 0.005), 1.5, EPS);
+
+    // An ask-side boundary: bids deep at 102 clear asks through 101, not 103
+    const DepthLadder deepBids({{102.0, 10.0}});
+    CHECK_NEAR(SyntheticInstrumentCalculator::optimalArbitrageSize(asks(), deepBids, 0.0, 0.0), 3.0, EPS);
+
+    // Everything clears: capped by the thinner side
+    const DepthLadder highBids({{110.0, 2.0}});
+    CHECK_NEAR(SyntheticInstrumentCalculator::optimalArbitrageSize(asks(), highBids, 0.0, 0.0), 2.0, EPS);
+
+    // Nothing clears, or a side is empty
+    const DepthLadder lowBids({{99.0, 5.0}});
+    CHECK(SyntheticInstrumentCalculator::optimalArbitrageSize(asks(), lowBids, 0.0, 0.0) == 0.0);
+    CHECK(SyntheticInstrumentCalculator::optimalArbitrageSize(asks(), DepthLadder(), 0.0, 0.0) == 0.0);
+}
+
+static void executableArbitrageCapsCapital() {
+    const TopOfBook none{};
+    const ArbitrageOpportunity uncapped = SyntheticInstrumentCalculator::evaluateExecutableArbitrage(
+        "TEST", "A", "B", asks(), bids(), 0.0, 0.0, 0.0, 1e9, none, none);
+    CHECK_NEAR(uncapped.capital, 100.0 + 1.5 * 101.0, EPS);
+    CHECK_NEAR(uncapped.longPrice, (100.0 + 1.5 * 101.0) / 2.5, EPS);
+    CHECK_NEAR(uncapped.shortPrice, (1.5 * 104.0 + 102.0) / 2.5, EPS);
+
+    // 150 USDT buys 1 at 100 and 50/101 at 101
+    const ArbitrageOpportunity capped = SyntheticInstrumentCalculator::evaluateExecutableArbitrage(
+        "TEST", "A", "B", asks(), bids(), 0.0, 0.0, 0.0, 150.0, none, none);
+    CHECK_NEAR(capped.capital, 150.0, 1e-6);
+    CHECK(capped.profitPercentage > 0.0);
+
+    // Below the threshold nothing is returned
+    const ArbitrageOpportunity rejected = SyntheticInstrumentCalculator::evaluateExecutableArbitrage(
+        "TEST", "A", "B", asks(), bids(), 0.0, 0.0, 50.0, 1e9, none, none);
+    CHECK(rejected.capital == 0.0);
+}
+
+int main() {
+    ladderQueries();
+    optimalSizeStopsAtTheLastClearingBoundary();
+    executableArbitrageCapsCapital();
+    return testFailures();
+}
@@ -0,0 +1,220 @@
+#include "TestCheck.hpp"
+#include "exchange/BookTickerParser.hpp"
+#include "exchange/MarkPriceParser.hpp"
+#include <exception>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr double EPS = 1e-12;
+
+    const std::string TICKER =
+        R"({"stream":"btcusdt@bookTicker","data":{"u":400900217,"s":"BTCUSDT","b":"25.35190000","B":"31.21000000","a":"25.36520000","A":"40.66000000"}})";
+
+    const std::string MARK_PRICES =
+        R"([{"e":"markPriceUpdate","E":1562305380000,"s":"BTCUSDT","p":"11794.15000000","ap":"11794.1","P":"11784.6","i":"11784.62659091","r":"0.00038167","T":1562306400000},)"
+        R"({"e":"markPriceUpdate","E":1562305380000,"s":"ETHUSDT","p":"300.5","ap":"300.5","P":"300.4","i":"300.3","r":"-0.0001","T":1562306400000}])";
+
+    // What BinanceClient does: the fast path, then the JSON parser if it refuses
+    bool parseEither(const std::string& payload, OrderBookUpdate& update, bool& fellBack) {
+        fellBack = false;
+        if (BookTickerParser::parse(payload, update)) return true;
+        fellBack = true;
+        try {
+            return BookTickerParser::parseWithJson(payload, update);
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+}
+
+static void tickerFieldsMatchTheJsonParser() {
+    BookTicker ticker;
+    CHECK(BookTickerParser::parse(TICKER, ticker));
+    CHECK(ticker.symbol == "BTCUSDT");
+    CHECK_NEAR(ticker.bid, 25.3519, EPS);
+    CHECK_NEAR(ticker.bidQty, 31.21, EPS);
+    CHECK_NEAR(ticker.ask, 25.3652, EPS);
+    CHECK_NEAR(ticker.askQty, 40.66, EPS);
+    CHECK(ticker.updateId == 400900217);
+    CHECK(ticker.eventTime == 0); // spot sends no E
+
+    OrderBookUpdate fast{}, slow{};
+    int64_t updateId = 0;
+    CHECK(BookTickerParser::parse(TICKER, fast));
+    CHECK(BookTickerParser::parseWithJson(TICKER, slow, updateId));
+    CHECK(fast.symbol == slow.symbol);
+    CHECK(fast.bestBid == slow.bestBid);
+    CHECK(fast.bestAsk == slow.bestAsk);
+    CHECK(fast.bestBidQty == slow.bestBidQty);
+    CHECK(fast.bestAskQty == slow.bestAskQty);
+    CHECK(updateId == ticker.updateId);
+}
+
+static void tickerKeysInAnyOrder() {
+    const std::string reordered =
+        R"({ "data" : { "A":"40.66", "a":"25.3652", "E":1700000000123, "s":"BTCUSDT", "B":"31.21", "b":"25.3519", "u":7 },)"
+        "\n  \"stream\" : \"btcusdt@bookTicker\" }";
+
+    BookTicker ticker;
+    CHECK(BookTickerParser::parse(reordered, ticker));
+    CHECK(ticker.symbol == "BTCUSDT");
+    CHECK_NEAR(ticker.bid, 25.3519, EPS);
+    CHECK_NEAR(ticker.ask, 25.3652, EPS);
+    CHECK_NEAR(ticker.askQty, 40.66, EPS);
+    CHECK(ticker.eventTime == 1700000000123);
+    CHECK(ticker.updateId == 7);
+
+    // Unknown and multi-letter keys are skipped, not mistaken for "b"/"a"
+    const std::string extra =
+        R"({"stream":"x","data":{"bb":"1","s":"BTCUSDT","b":"2","B":"3","a":"4","A":"5","aa":"6"}})";
+    CHECK(BookTickerParser::parse(extra, ticker));
+    CHECK(ticker.bid == 2.0);
+    CHECK(ticker.ask == 4.0);
+}
+
+static void tickerNumbersInEveryNotation() {
+    const std::string frame =
+        R"({"stream":"x","data":{"s":"BTCUSDT","b":"1.5e4","B":"2E-3","a":"-0.5","A":"0","u":"12"}})";
+
+    BookTicker ticker;
+    CHECK(BookTickerParser::parse(frame, ticker));
+    CHECK_NEAR(ticker.bid, 15000.0, EPS);
+    CHECK_NEAR(ticker.bidQty, 0.002, EPS);
+    CHECK_NEAR(ticker.ask, -0.5, EPS);
+    CHECK(ticker.askQty == 0.0);
+    CHECK(ticker.updateId == 12);
+
+    // Not a number at all: refused, never read as 0
+    const std::string garbage = R"({"stream":"x","data":{"s":"BTCUSDT","b":"1.5x","B":"1","a":"2","A":"1"}})";
+    CHECK(!BookTickerParser::parse(garbage, ticker));
+    const std::string fractionalId = R"({"stream":"x","data":{"s":"BTCUSDT","b":"1","B":"1","a":"2","A":"1","u":1.5}})";
+    CHECK(!BookTickerParser::parse(fractionalId, ticker));
+}
+
+static void escapedTickerFallsBackToJson() {
+    // \u0055 is 'U': the fast path refuses escapes, the JSON parser decodes them
+    const std::string escaped =
+        R"({"stream":"btcusdt@bookTicker","data":{"u":5,"s":"BTC\u0055SDT","b":"1.25","B":"2","a":"1.5","A":"3"}})";
+
+    BookTicker ticker;
+    CHECK(!BookTickerParser::parse(escaped, ticker));
+
+    OrderBookUpdate update{};
+    bool fellBack = false;
+    CHECK(parseEither(escaped, update, fellBack));
+    CHECK(fellBack);
+    CHECK(update.symbol == "BTCUSDT");
+    CHECK(update.bestBid == 1.25);
+    CHECK(update.bestAsk == 1.5);
+
+    // Escapes outside the data object also send the frame to the fallback
+    const std::string escapedStream =
+        R"({"stream":"btc\"usdt","data":{"s":"BTCUSDT","b":"1","B":"1","a":"2","A":"1"}})";
+    CHECK(!BookTickerParser::parse(escapedStream, ticker));
+    CHECK(parseEither(escapedStream, update, fellBack));
+    CHECK(fellBack);
+
+    // The canonical frame never takes the fallback
+    CHECK(parseEither(TICKER, update, fellBack));
+    CHECK(!fellBack);
+}
+
+static void unexpectedTickerShapesAreRefused() {
+    BookTicker ticker;
+    CHECK(!BookTickerParser::parse("", ticker));
+    CHECK(!BookTickerParser::parse("[]", ticker));
+    CHECK(!BookTickerParser::parse(R"({"stream":"x"})", ticker));                            // no data
+    CHECK(!BookTickerParser::parse(R"({"stream":"x","data":{}})", ticker));                  // empty data
+    CHECK(!BookTickerParser::parse(R"({"stream":"x","data":[1]})", ticker));                 // not an object
+    CHECK(!BookTickerParser::parse(R"({"data":{"s":"BTCUSDT","b":"1","B":"1","a":"2"}})", ticker)); // no A
+    CHECK(!BookTickerParser::parse(R"({"data":{"s":"BTCUSDT","b":{"x":1},"B":"1","a":"2","A":"1"}})", ticker));
+
+    // The JSON fallback turns away a frame without data instead of inventing one
+    OrderBookUpdate update{};
+    CHECK(!BookTickerParser::parseWithJson(R"({"result":null,"id":1})", update));
+}
+
+static void truncatedTickerIsRefused() {
+    BookTicker ticker;
+    for (size_t length = 0; length < TICKER.size(); ++length) {
+        const bool parsed = BookTickerParser::parse(std::string_view(TICKER).substr(0, length), ticker);
+        if (parsed) std::cerr << "   truncated at " << length << " of " << TICKER.size() << "\n";
+        CHECK(!parsed);
+    }
+
+    // Every truncation is also malformed JSON, so the fallback rejects it too
+    OrderBookUpdate update{};
+    bool fellBack = false;
+    CHECK(!parseEither(TICKER.substr(0, TICKER.size() / 2), update, fellBack));
+    CHECK(fellBack);
+}
+
+static void markPricesForWatchedSymbolsOnly() {
+    SymbolTable watched;
+    const int btc = watched.add("BTCUSDT");
+
+    std::vector<MarkPriceEntry> out;
+    CHECK(MarkPriceParser::parse(MARK_PRICES, watched, out));
+    CHECK(out.size() == 1);
+    CHECK(out[0].symbolId == btc);
+    CHECK_NEAR(out[0].markPrice, 11794.15, EPS);
+    CHECK_NEAR(out[0].indexPrice, 11784.62659091, EPS);
+    CHECK_NEAR(out[0].fundingRate, 0.00038167, EPS);
+    CHECK(out[0].nextFundingTime == 1562306400000);
+    CHECK(out[0].eventTime == 1562305380000);
+
+    // Nothing watched in the payload: a valid, empty batch
+    SymbolTable none;
+    none.add("SOLUSDT");
+    CHECK(MarkPriceParser::parse(MARK_PRICES, none, out));
+    CHECK(out.empty());
+
+    // Negative and exponent notation; keys in any order, "s" last included
+    const std::string reordered =
+        R"([ {"T":1562306400000, "r":"-1.25e-4", "i":"3.0E2", "p":"300.5", "E":1, "s":"ETHUSDT"} ])";
+    const int eth = watched.add("ETHUSDT");
+    CHECK(MarkPriceParser::parse(reordered, watched, out));
+    CHECK(out.size() == 1);
+    CHECK(out[0].symbolId == eth);
+    CHECK_NEAR(out[0].fundingRate, -0.000125, EPS);
+    CHECK_NEAR(out[0].indexPrice, 300.0, EPS);
+    CHECK_NEAR(out[0].markPrice, 300.5, EPS);
+
+    CHECK(MarkPriceParser::parse(MARK_PRICES, watched, out));
+    CHECK(out.size() == 2);
+    CHECK(out[1].symbolId == eth);
+    CHECK_NEAR(out[1].fundingRate, -0.0001, EPS);
+}
+
+static void unexpectedMarkPriceShapesFallBack() {
+    SymbolTable watched;
+    watched.add("BTCUSDT");
+    std::vector<MarkPriceEntry> out;
+
+    // Each of these sends BinancePerpClient to its JSON fallback
+    CHECK(!MarkPriceParser::parse("", watched, out));
+    CHECK(!MarkPriceParser::parse(R"({"s":"BTCUSDT"})", watched, out));            // object, not array
+    CHECK(!MarkPriceParser::parse(R"([{"s":"BTC\u0055SDT","p":"1","i":"1","r":"0","T":1,"E":1}])", watched, out)); // escaped symbol
+    CHECK(!MarkPriceParser::parse(R"([{"s":"BTCUSDT","p":"1","i":"1","r":"0","E":1}])", watched, out)); // no T
+    CHECK(!MarkPriceParser::parse(R"([{"s":"BTCUSDT","p":"1e","i":"1","r":"0","T":1,"E":1}])", watched, out));
+    CHECK(out.empty());
+
+    for (size_t length = 0; length < MARK_PRICES.size(); ++length) {
+        const bool parsed = MarkPriceParser::parse(std::string_view(MARK_PRICES).substr(0, length), watched, out);
+        if (parsed) std::cerr << "   truncated at " << length << " of " << MARK_PRICES.size() << "\n";
+        CHECK(!parsed);
+    }
+}
+
+int main() {
+    tickerFieldsMatchTheJsonParser();
+    tickerKeysInAnyOrder();
+    tickerNumbersInEveryNotation();
+    escapedTickerFallsBackToJson();
+    unexpectedTickerShapesAreRefused();
+    truncatedTickerIsRefused();
+    markPricesForWatchedSymbolsOnly();
+    unexpectedMarkPriceShapesFallBack();
+    return testFailures();
+}
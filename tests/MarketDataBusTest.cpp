@@ -0,0 +1,183 @@
+#include "TestCheck.hpp"
+#include "exchange/MarketDataBus.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace {
+    // The instrument field carries a per-venue running number
+    TopOfBook numbered(int venue, int n) {
+        TopOfBook top{};
+        top.instrument = n;
+        top.venue = static_cast<int16_t>(venue);
+        top.bestBid = 100.0;
+        top.bestAsk = 101.0;
+        return top;
+    }
+
+    void drain(MarketDataBus& bus, int consumer) {
+        while (bus.poll(consumer)) {
+        }
+    }
+}
+
+static void pollSeesEveryVenueInPublishOrder() {
+    MarketDataBus bus;
+    const int a = bus.addVenue("A", 16);
+    const int b = bus.addVenue("B", 2 * MarketDataBus::BATCH);
+
+    std::vector<int> seenA, seenB;
+    const int consumer = bus.addConsumer("Reader", [&](const TopOfBook& top) {
+        (top.venue == a ? seenA : seenB).push_back(top.instrument);
+    });
+
+    CHECK(!bus.poll(consumer)); // nothing published yet
+
+    for (int n = 0; n < 10; ++n) {
+        bus.publish(a, numbered(a, n));
+        if (n % 2 == 0) bus.publish(b, numbered(b, n));
+    }
+    drain(bus, consumer);
+
+    CHECK(seenA.size() == 10);
+    for (size_t i = 0; i < seenA.size(); ++i) CHECK(seenA[i] == static_cast<int>(i));
+    CHECK(seenB.size() == 5);
+    for (size_t i = 0; i < seenB.size(); ++i) CHECK(seenB[i] == static_cast<int>(2 * i));
+
+    // Each update is delivered once
+    drain(bus, consumer);
+    CHECK(seenA.size() == 10);
+
+    // More than BATCH per venue leaves work behind for the next poll
+    for (int n = 0; n < static_cast<int>(MarketDataBus::BATCH) + 1; ++n) bus.publish(b, numbered(b, 100 + n));
+    seenB.clear();
+    CHECK(bus.poll(consumer));
+    CHECK(seenB.size() == MarketDataBus::BATCH);
+    CHECK(!bus.poll(consumer));
+    CHECK(seenB.size() == MarketDataBus::BATCH + 1);
+    CHECK(seenB.back() == 100 + static_cast<int>(MarketDataBus::BATCH));
+}
+
+static void gatedConsumerNeverRunsAhead() {
+    MarketDataBus bus;
+    const int venue = bus.addVenue("A", 64);
+
+    int stateSeen = 0;
+    int riskSeen = 0;
+    const int state = bus.addConsumer("Market State", [&](const TopOfBook&) { ++stateSeen; });
+    const int risk = bus.addConsumer("Risk", [&](const TopOfBook& top) {
+        CHECK(top.instrument < stateSeen);
+        ++riskSeen;
+    }, {state});
+
+    for (int n = 0; n < 5; ++n) bus.publish(venue, numbered(venue, n));
+
+    // Nothing for Risk until Market State has finished with it
+    CHECK(!bus.poll(risk));
+    CHECK(riskSeen == 0);
+
+    drain(bus, state);
+    CHECK(stateSeen == 5);
+    drain(bus, risk);
+    CHECK(riskSeen == 5);
+}
+
+static void gatedConsumerNeverRunsAheadAcrossThreads() {
+    constexpr int UPDATES = 20000;
+
+    MarketDataBus bus;
+    const int venue = bus.addVenue("A", 1024);
+
+    std::atomic<int> stateSeen{0};
+    std::atomic<int> riskSeen{0};
+    std::atomic<int> ahead{0};
+    const int state = bus.addConsumer("Market State", [&](const TopOfBook&) {
+        stateSeen.fetch_add(1, std::memory_order_relaxed);
+    });
+    const int risk = bus.addConsumer("Risk", [&](const TopOfBook& top) {
+        if (top.instrument >= stateSeen.load(std::memory_order_relaxed)) ahead.fetch_add(1);
+        riskSeen.fetch_add(1, std::memory_order_relaxed);
+    }, {state});
+
+    bus.start(state, WaitStrategy::Yield);
+    bus.start(risk, WaitStrategy::Block);
+
+    // Never publish more than a ring ahead, so nothing is dropped
+    for (int n = 0; n < UPDATES; ++n) {
+        while (n - riskSeen.load() >= 1024) std::this_thread::yield();
+        bus.publish(venue, numbered(venue, n));
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (riskSeen.load() < UPDATES && std::chrono::steady_clock::now() < deadline) std::this_thread::yield();
+    bus.stop();
+
+    CHECK(stateSeen.load() == UPDATES);
+    CHECK(riskSeen.load() == UPDATES);
+    CHECK(ahead.load() == 0);
+}
+
+static void ringDropsWhenTheSlowestConsumerIsLapped() {
+    MulticastRing<TopOfBook> ring(5); // rounded up to 8
+    CHECK(ring.capacity() == 8);
+
+    Sequence fast, slow;
+    ring.addGatingSequence(fast);
+    ring.addGatingSequence(slow);
+
+    for (int n = 0; n < 8; ++n) CHECK(ring.tryPublish(numbered(0, n)));
+    fast.store(ring.published());
+
+    // The slow consumer still holds the whole ring: the new entry is dropped
+    CHECK(!ring.tryPublish(numbered(0, 8)));
+    CHECK(!ring.tryPublish(numbered(0, 9)));
+    CHECK(ring.droppedCount() == 2);
+    CHECK(ring.published() == 7);
+    CHECK(ring.get(0).instrument == 0); // not overwritten
+
+    // Room for exactly as many as it has released
+    slow.store(2);
+    for (int n = 10; n < 13; ++n) CHECK(ring.tryPublish(numbered(0, n)));
+    CHECK(!ring.tryPublish(numbered(0, 13)));
+    CHECK(ring.droppedCount() == 3);
+    CHECK(ring.get(8).instrument == 10);
+    CHECK(ring.get(3).instrument == 3);
+}
+
+static void busDropsNewestWhenAConsumerFallsARingBehind() {
+    MarketDataBus bus;
+    const int venue = bus.addVenue("A", 8);
+
+    int fastSeen = 0;
+    std::vector<int> slowSeen;
+    const int fast = bus.addConsumer("Fast", [&](const TopOfBook&) { ++fastSeen; });
+    const int slow = bus.addConsumer("Slow", [&](const TopOfBook& top) { slowSeen.push_back(top.instrument); });
+
+    for (int n = 0; n < 12; ++n) {
+        bus.publish(venue, numbered(venue, n));
+        drain(bus, fast);
+    }
+
+    // Both consumers see the same 8; the 4 published into a full ring are gone
+    CHECK(fastSeen == 8);
+    drain(bus, slow);
+    CHECK(slowSeen.size() == 8);
+    for (size_t i = 0; i < slowSeen.size(); ++i) CHECK(slowSeen[i] == static_cast<int>(i));
+
+    // Once the slow consumer catches up, publishing resumes
+    bus.publish(venue, numbered(venue, 12));
+    drain(bus, fast);
+    drain(bus, slow);
+    CHECK(fastSeen == 9);
+    CHECK(slowSeen.back() == 12);
+}
+
+int main() {
+    pollSeesEveryVenueInPublishOrder();
+    gatedConsumerNeverRunsAhead();
+    gatedConsumerNeverRunsAheadAcrossThreads();
+    ringDropsWhenTheSlowestConsumerIsLapped();
+    busDropsNewestWhenAConsumerFallsARingBehind();
+    return testFailures();
+}
@@ -0,0 +1,46 @@
+#include "TestCheck.hpp"
+#include "exchange/OrderBook.hpp"
+#include <string>
+
+// OKX checksums over the level text as sent. Expected values are the
+// signed CRC32 (zlib.crc32) of the interleaved "bidPx:bidSz:askPx:askSz:..."
+// string.
+static void checksumInterleavesLevels() {
+    OrderBook book(true);
+    book.apply(OrderBook::Side::Bid, 3366.1, 7, "3366.1", "7");
+    book.apply(OrderBook::Side::Bid, 3366.0, 6, "3366", "6");
+    book.apply(OrderBook::Side::Bid, 3365.5, 1, "3365.5", "1");
+    book.apply(OrderBook::Side::Ask, 3366.8, 9, "3366.8", "9");
+    book.apply(OrderBook::Side::Ask, 3368.0, 8, "3368", "8");
+
+    // "3366.1:7:3366.8:9:3366:6:3368:8:3365.5:1"
+    CHECK(book.okxChecksum() == -1587199491);
+
+    // Removing a level drops its text too; the shorter ask side is skipped
+    // "3366.1:7:3366.8:9:3365.5:1:3368:8"
+    book.apply(OrderBook::Side::Bid, 3366.0, 0);
+    CHECK(book.okxChecksum() == -49181668);
+    CHECK(!book.textOverflow());
+}
+
+static void overlongTextIsReported() {
+    OrderBook book(true);
+    const std::string longQty(OrderBook::MAX_LEVEL_TEXT + 1, '1');
+    book.apply(OrderBook::Side::Bid, 100.0, 1, "100", std::string(OrderBook::MAX_LEVEL_TEXT, '1'));
+    CHECK(!book.textOverflow());
+
+    book.apply(OrderBook::Side::Ask, 101.0, 1, "101", longQty);
+    CHECK(book.textOverflow());
+
+    // Removing the level doesn't make the book checksummable again; a fresh snapshot does
+    book.apply(OrderBook::Side::Ask, 101.0, 0);
+    CHECK(book.textOverflow());
+    book.clear();
+    CHECK(!book.textOverflow());
+}
+
+int main() {
+    checksumInterleavesLevels();
+    overlongTextIsReported();
+    return testFailures();
+}
@@ -0,0 +1,83 @@
+#include "TestCheck.hpp"
+#include "exchange/SeqLock.hpp"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace {
+    // Every word holds the same value, so a copy mixing two writes shows up
+    struct Stamped {
+        uint64_t words[128];
+    };
+
+    Stamped stamped(uint64_t value) {
+        Stamped s{};
+        for (auto& w : s.words) w = value;
+        return s;
+    }
+
+    bool consistent(const Stamped& s) {
+        for (auto w : s.words) {
+            if (w != s.words[0]) return false;
+        }
+        return true;
+    }
+}
+
+static void storeThenLoad() {
+    SeqLock<Stamped> lock;
+    CHECK(lock.version() == 0);
+    CHECK(consistent(lock.load()));
+    CHECK(lock.load().words[0] == 0);
+
+    lock.store(stamped(7));
+    CHECK(lock.version() == 1);
+
+    Stamped out{};
+    uint64_t version = 0;
+    CHECK(lock.tryLoad(out, version));
+    CHECK(version == 1);
+    CHECK(out.words[0] == 7);
+    CHECK(consistent(out));
+}
+
+static void readerNeverSeesATornCopy() {
+    constexpr uint64_t WRITES = 2000000;
+
+    SeqLock<Stamped> lock;
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> torn{0};
+    std::atomic<uint64_t> backwards{0};
+    std::atomic<uint64_t> reads{0};
+
+    std::thread reader([&] {
+        uint64_t last = 0;
+        while (!done.load(std::memory_order_acquire)) {
+            Stamped out;
+            uint64_t version;
+            if (!lock.tryLoad(out, version)) continue;
+
+            // Write n stores stamp n, so a good copy matches its version too
+            if (!consistent(out) || out.words[0] != version) torn.fetch_add(1);
+            if (out.words[0] < last) backwards.fetch_add(1);
+            last = out.words[0];
+            reads.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    for (uint64_t n = 1; n <= WRITES; ++n) lock.store(stamped(n));
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    CHECK(torn.load() == 0);
+    CHECK(backwards.load() == 0);
+    CHECK(reads.load() > 0);
+    CHECK(lock.load().words[0] == WRITES);
+    CHECK(lock.version() == WRITES);
+}
+
+int main() {
+    storeThenLoad();
+    readerNeverSeesATornCopy();
+    return testFailures();
+}
@@ -0,0 +1,129 @@
+#include "TestCheck.hpp"
+#include "exchange/SequenceTracker.hpp"
+#include "exchange/InstrumentRegistry.hpp"
+#include <vector>
+
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+namespace {
+    struct Harness {
+        std::vector<int> requests;
+        SequenceTracker tracker{InstrumentRegistry::registerVenue("Test"), 2, [this](int id) { requests.push_back(id); }};
+    };
+}
+
+static void gapRequestsResyncAtOnce() {
+    Harness h;
+    const MonoTimestamp t0{};
+    h.tracker.snapshot(0, 100, t0);
+    h.tracker.snapshot(1, 7, t0);
+
+    CHECK(h.tracker.advance(0, 100, 101, t0 + milliseconds(1)));
+    CHECK(h.tracker.last(0) == 101);
+    CHECK(h.requests.empty());
+
+    // 102 was skipped
+    CHECK(!h.tracker.advance(0, 102, 103, t0 + milliseconds(2)));
+    CHECK(!h.tracker.valid(0));
+    CHECK(h.requests.size() == 1 && h.requests[0] == 0);
+
+    // Updates while invalid are refused without another request; the other instrument is untouched
+    CHECK(!h.tracker.advance(0, 103, 104, t0 + milliseconds(3)));
+    CHECK(h.requests.size() == 1);
+    CHECK(h.tracker.valid(1));
+    CHECK(h.tracker.advance(1, 7, 8, t0 + milliseconds(3)));
+}
+
+static void snapshotResyncs() {
+    Harness h;
+    const MonoTimestamp t0{};
+    h.tracker.snapshot(0, 100, t0);
+    h.tracker.invalidate(0, t0 + milliseconds(10)); // e.g. a checksum mismatch
+    CHECK(h.requests.size() == 1);
+
+    h.tracker.snapshot(0, 500, t0 + milliseconds(50));
+    CHECK(h.tracker.valid(0));
+    CHECK(h.tracker.last(0) == 500);
+    CHECK(h.tracker.advance(0, 500, 501, t0 + milliseconds(60)));
+
+    // Nothing left pending, so later polls stay quiet
+    h.tracker.poll(t0 + seconds(60));
+    CHECK(h.requests.size() == 1);
+}
+
+static void backoffDoublesToTheCap() {
+    Harness h;
+    const MonoTimestamp t0{};
+    h.tracker.snapshot(0, 1, t0);
+    h.tracker.invalidate(0, t0);
+    CHECK(h.requests.size() == 1);
+
+    // No snapshot comes back: 500 ms, 1 s, 2 s, ... capped at 30 s
+    const milliseconds expected[] = {milliseconds(500), seconds(1), seconds(2), seconds(4), seconds(8),
+                                     seconds(16), seconds(30), seconds(30)};
+    MonoTimestamp now = t0;
+    size_t sent = 1;
+    for (milliseconds wait : expected) {
+        h.tracker.poll(now + wait - milliseconds(1));
+        CHECK(h.requests.size() == sent);
+        now += wait;
+        h.tracker.poll(now);
+        CHECK(h.requests.size() == ++sent);
+    }
+}
+
+static void regapWaitsUntilStable() {
+    Harness h;
+    MonoTimestamp now{};
+    h.tracker.snapshot(0, 1, now);
+    h.tracker.invalidate(0, now);   // request 1, immediate
+    now += milliseconds(500);
+    h.tracker.poll(now);            // request 2
+    CHECK(h.requests.size() == 2);
+    h.tracker.snapshot(0, 10, now + milliseconds(100));
+
+    // Gapping again shortly after waits out the next step (1 s) instead of asking at once
+    now += seconds(5);
+    h.tracker.invalidate(0, now);
+    CHECK(h.requests.size() == 2);
+    h.tracker.poll(now + milliseconds(999));
+    CHECK(h.requests.size() == 2);
+    h.tracker.poll(now + seconds(1));
+    CHECK(h.requests.size() == 3);
+
+    // After STABLE_AFTER of valid book the backoff resets and a gap asks at once
+    now += seconds(2);
+    h.tracker.snapshot(0, 20, now);
+    now += SequenceTracker::STABLE_AFTER;
+    h.tracker.invalidate(0, now);
+    CHECK(h.requests.size() == 4);
+    now += milliseconds(500);
+    h.tracker.poll(now);
+    CHECK(h.requests.size() == 5);
+}
+
+static void resetForgetsEverything() {
+    Harness h;
+    const MonoTimestamp t0{};
+    h.tracker.snapshot(0, 100, t0);
+    h.tracker.invalidate(0, t0);
+    CHECK(h.requests.size() == 1);
+
+    // A replay pass starting over: no retry left, and the first frame is judged afresh
+    h.tracker.reset();
+    h.tracker.poll(t0 + seconds(60));
+    CHECK(h.requests.size() == 1);
+    CHECK(!h.tracker.valid(0));
+    h.tracker.snapshot(0, 5, t0 + seconds(61));
+    CHECK(h.tracker.advance(0, 5, 6, t0 + seconds(61)));
+}
+
+int main() {
+    gapRequestsResyncAtOnce();
+    snapshotResyncs();
+    backoffDoublesToTheCap();
+    regapWaitsUntilStable();
+    resetForgetsEverything();
+    return testFailures();
+}
@@ -0,0 +1,146 @@
+#include "TestCheck.hpp"
+#include "arbitrage/StrategyChecks.hpp"
+#include "arbitrage/SyntheticInstrumentCalculator.hpp"
+
+namespace {
+    TopOfBook quote(VenueId venue, InstrumentId instrument, double bid, double ask) {
+        TopOfBook top{};
+        top.venue = static_cast<int16_t>(venue);
+        top.instrument = instrument;
+        top.bestBid = bid;
+        top.bestAsk = ask;
+        top.bestBidQty = 1.0;
+        top.bestAskQty = 1.0;
+        return top;
+    }
+
+    SyntheticId findSynthetic(const SyntheticGraph& graph, const std::string& name) {
+        for (size_t id = 0; id < graph.size(); ++id)
+            if (graph.name(static_cast<SyntheticId>(id)) == name) return static_cast<SyntheticId>(id);
+        return -1;
+    }
+}
+
+// The synthetic future's premium is the funding its perp pays over the
+// window, so at any funding rate the Spot vs Synthetic Future trade nets
+// out to its fees and never clears
+static void syntheticFutureNetsOutToFees() {
+    FeeSchedule fees;
+    fees.loadDefaults();
+    SyntheticGraph graph;
+    defineSynthetics(graph, fees);
+
+    const VenueId binance = InstrumentRegistry::venueId("Binance");
+    const VenueId okx = InstrumentRegistry::venueId("OKX");
+    const InstrumentId btc = primaryInstrument();
+    const SyntheticId future = findSynthetic(graph, "BTC/USDT Synthetic Future (OKX + funding)");
+    CHECK(future >= 0);
+    if (future < 0) return;
+
+    const double okxFees = 2.0 * fees.taker(okx, ProductType::Spot) * 100.0;
+    const double settlements = SYNTHETIC_FUTURE_HOURS / 8.0;
+
+    // Per 8h settlement: quiet, typical, busy, hot, and shorts paying longs
+    for (double fundingRate : {0.0001, 0.00015, 0.0002, 0.0005, -0.0001}) {
+        graph.update(quote(binance, btc, 60000.0, 60002.0), fundingRate);
+        graph.update(quote(okx, btc, 59990.0, 60010.0), 0.0);
+        const double real = 60000.0;
+        const double synthetic = graph.value(future);
+        CHECK_NEAR(synthetic, real * (1.0 + fundingRate * settlements), 1e-6);
+
+        const double feePercent = syntheticFutureFeePercent(fees, fundingRate, synthetic > real);
+        const double net = SyntheticInstrumentCalculator::netEdgePercent(real, synthetic, feePercent);
+        CHECK_NEAR(net, -okxFees, 1e-3);
+        CHECK(net < MIN_NET_EDGE_BPS / 100.0);
+    }
+}
+
+// A feed that loses a book's sequence publishes it withdrawn; until the
+// snapshot, the venue's last quote is neither fresh, nor in the consolidated
+// book, nor a scanner candidate
+static void withdrawnBookLeavesEveryView() {
+    MarketDataAggregator aggregator;
+    ConsolidatedBook consolidated;
+    TickHistory history;
+    QuoteFreshness freshness(QuoteFreshness::Clock::Recorded);
+    SyntheticGraph synthetics;
+    FeeSchedule fees;
+    fees.loadDefaults();
+    CrossVenueScanner scanner(freshness, MIN_NET_EDGE_BPS);
+    CurrencyCycleDetector cycles(freshness, MIN_NET_EDGE_BPS);
+    StrategyDispatcher dispatcher;
+    const MarketState state{aggregator, consolidated, history, freshness, synthetics, scanner, cycles, fees};
+
+    const VenueId binance = InstrumentRegistry::venueId("Binance");
+    const VenueId okx = InstrumentRegistry::venueId("OKX");
+    const InstrumentId eth = InstrumentRegistry::registerInstrument("ETH/USDT");
+    const MonoTimestamp t0 = MonoTimestamp{} + std::chrono::seconds(100);
+
+    // OKX bids above Binance's ask: crossed and a scanner candidate
+    TopOfBook binanceQuote = quote(binance, eth, 3000.0, 3001.0);
+    TopOfBook okxQuote = quote(okx, eth, 3010.0, 3011.0);
+    binanceQuote.receiveTime = okxQuote.receiveTime = t0;
+    applyMarketUpdate(state, dispatcher, binanceQuote);
+    applyMarketUpdate(state, dispatcher, okxQuote);
+    CHECK(consolidated.isCrossed(eth));
+    CHECK(freshness.areFresh(eth, QuoteFreshness::bit(okx)));
+    CHECK(scanner.scan().size() == 1);
+
+    TopOfBook withdrawn = okxQuote;
+    withdrawn.bestBid = withdrawn.bestAsk = withdrawn.bestBidQty = withdrawn.bestAskQty = 0.0;
+    withdrawn.receiveTime = t0 + std::chrono::milliseconds(1);
+    CHECK(withdrawn.withdrawn());
+    applyMarketUpdate(state, dispatcher, withdrawn);
+
+    CHECK(!consolidated.isCrossed(eth));
+    CHECK(consolidated.bids(eth).size() == 1);
+    CHECK(!freshness.areFresh(eth, QuoteFreshness::bit(okx)));
+    CHECK(freshness.areFresh(eth, QuoteFreshness::bit(binance)));
+    CHECK(scanner.scan().empty());
+    TopOfBook stored;
+    CHECK(aggregator.getLatest(okx, eth, stored) && stored.withdrawn());
+
+    // The snapshot brings it back
+    okxQuote.receiveTime = t0 + std::chrono::milliseconds(2);
+    applyMarketUpdate(state, dispatcher, okxQuote);
+    CHECK(consolidated.isCrossed(eth));
+    CHECK(freshness.areFresh(eth, QuoteFreshness::bit(okx)));
+}
+
+// Crosses are spot-only: Bybit streams linear perps, which the registry
+// names like spot pairs but which convert nothing
+static void cyclesOnlyCloseOverSpotVenues() {
+    const auto perpSymbols = venueSymbols("", false, false);
+    const auto spotSymbols = venueSymbols("", false, true);
+    CHECK(perpSymbols.size() == WATCHED_ASSETS.size());
+    CHECK(spotSymbols.size() == WATCHED_ASSETS.size() + WATCHED_CROSSES.size());
+    CHECK(spotSymbols.back() == "XRPBTC");
+
+    QuoteFreshness freshness;
+    CrossVenueScanner scanner(freshness, MIN_NET_EDGE_BPS);
+    CurrencyCycleDetector cycles(freshness, MIN_NET_EDGE_BPS);
+    FeeSchedule fees;
+    fees.loadDefaults();
+    applyFees(fees, scanner, cycles);
+
+    const InstrumentId btcUsdt = InstrumentRegistry::registerInstrument("BTC/USDT");
+    const InstrumentId ethUsdt = InstrumentRegistry::registerInstrument("ETH/USDT");
+    const InstrumentId ethBtc = InstrumentRegistry::registerInstrument("ETH/BTC");
+
+    // USDT -> BTC -> ETH -> USDT returns about 3% before fees
+    auto triangle = [&](VenueId venue) {
+        bool flagged = cycles.update(quote(venue, btcUsdt, 59990.0, 60000.0));
+        flagged |= cycles.update(quote(venue, ethUsdt, 3100.0, 3101.0));
+        flagged |= cycles.update(quote(venue, ethBtc, 0.0499, 0.05));
+        return flagged;
+    };
+    CHECK(!triangle(InstrumentRegistry::venueId("Bybit")));
+    CHECK(triangle(InstrumentRegistry::venueId("Binance")));
+}
+
+int main() {
+    syntheticFutureNetsOutToFees();
+    withdrawnBookLeavesEveryView();
+    cyclesOnlyCloseOverSpotVenues();
+    return testFailures();
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include <cmath>
+#include <iostream>
+
+// Minimal checks for the ctest executables: each failed CHECK prints a ❌
+// with its location, and main() returns testFailures() so ctest sees it.
+inline int& testFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+#define CHECK(cond)                                                                  \
+    do {                                                                             \
+        if (!(cond)) {                                                               \
+            std::cerr << "❌ " << __FILE__ << ":" << __LINE__ << ": " #cond "\n"; \
+            ++testFailures();                                                        \
+        }                                                                            \
+    } while (0)
+
+#define CHECK_NEAR(a, b, eps) CHECK(std::abs((a) - (b)) <= (eps))
@@ -0,0 +1,267 @@
+// Replays a journal captured with `arb_engine --record <path>` through the
+// real client parsers, MarketDataBus, market state and StrategyDispatcher,
+// without touching the network.
+//
+//   feed_replay <journal> [--speed <x>] [--loops <n>] [--quiet]
+//
+//   --speed 0     as fast as possible (default); x > 0 paces frames at x times
+//                 the recorded speed
+//   --loops n     replay the journal n times (throughput runs)
+//   --quiet       drop strategy output, print only the summary
+//
+// Strategies are wired exactly as in arb_engine (connectStrategies) and
+// triggered by the same keys. The dispatcher is stepped after every frame
+// on the frame's recorded receive time, so periodics, staleness and
+// coalescing follow the recording's clock and a given journal always
+// produces the same sequence of evaluations.
+
+#include "exchange/BinanceClient.hpp"
+#include "exchange/OKXClient.hpp"
+#include "exchange/BybitClient.hpp"
+#include "exchange/BinancePerpClient.hpp"
+#include "exchange/MarketDataAggregator.hpp"
+#include "exchange/ConsolidatedBook.hpp"
+#include "exchange/TickHistory.hpp"
+#include "exchange/QuoteFreshness.hpp"
+#include "exchange/FeedJournal.hpp"
+#include "exchange/MarketDataBus.hpp"
+#include "arbitrage/StrategyChecks.hpp"
+#include "arbitrage/StrategyDispatcher.hpp"
+#include "arbitrage/TradeExecutor.hpp"
+#include "monitoring/LatencyMonitor.hpp"
+#include "monitoring/SequenceMonitor.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace {
+    struct ReplayOptions {
+        std::string path;
+        double speed = 0.0;
+        int loops = 1;
+        bool quiet = false;
+    };
+
+    struct VenueStats {
+        uint64_t frames = 0;
+        uint64_t bytes = 0;
+    };
+
+    struct NullBuffer : std::streambuf {
+        int overflow(int c) override { return c; }
+    };
+
+    void printUsage() {
+        std::cout << "Usage: feed_replay <journal> [--speed <x>] [--loops <n>] [--quiet]\n";
+    }
+
+    bool parseOptions(int argc, char** argv, ReplayOptions& options) {
+        for (int i = 1; i < argc; ++i) {
+            const bool hasValue = i + 1 < argc;
+            if (std::strcmp(argv[i], "--speed") == 0 && hasValue) {
+                options.speed = std::strtod(argv[++i], nullptr);
+            } else if (std::strcmp(argv[i], "--loops") == 0 && hasValue) {
+                options.loops = std::max(1, std::atoi(argv[++i]));
+            } else if (std::strcmp(argv[i], "--quiet") == 0) {
+                options.quiet = true;
+            } else if (argv[i][0] != '-' && options.path.empty()) {
+                options.path = argv[i];
+            } else {
+                return false;
+            }
+        }
+        return !options.path.empty();
+    }
+}
+
+int main(int argc, char** argv) {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    ReplayOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    FeedJournalReader reader(options.path);
+    if (!reader.isOpen()) return 1;
+
+    // Same wiring as main.cpp, minus the sockets and the threads
+    MarketDataAggregator aggregator;
+    aggregator.enableDepth(primaryInstrument()); // liquidity checks walk the book
+    StrategyDispatcher dispatcher;
+    ConsolidatedBook consolidated;
+    TickHistory tickHistory;
+    QuoteFreshness freshness(QuoteFreshness::Clock::Recorded); // ages by the recording's clock
+    SyntheticGraph synthetics;
+    CrossVenueScanner scanner(freshness, MIN_NET_EDGE_BPS);
+    CurrencyCycleDetector cycles(freshness, MIN_NET_EDGE_BPS);
+    FeeSchedule fees;
+    fees.loadDefaults();
+    defineSynthetics(synthetics, fees);
+    const MarketState state{aggregator, consolidated, tickHistory, freshness, synthetics, scanner, cycles, fees};
+    connectStrategies(dispatcher, state);
+    uint64_t bookUpdates = 0;
+
+    BinanceClient binance(venueSymbols("", true, true));
+    OKXClient okx(venueSymbols("-", false, true), "books");
+    BybitClient bybit(venueSymbols("", false, false), 50);
+    BinancePerpClient binancePerp("btcusdt");
+
+    MarketDataBus bus;
+    std::array<ExchangeClient*, 3> clients = {&binance, &okx, &bybit};
+    for (size_t feed = 0; feed < clients.size(); ++feed) {
+        auto* client = clients[feed];
+        bus.addVenue(client->name());
+        // Only exchange->receive is meaningful offline: it comes from the recording
+        const int venue = LatencyMonitor::registerVenue(client->name());
+        const VenueId venueId = InstrumentRegistry::registerVenue(client->name());
+        client->setOrderBookCallback([&aggregator, &bus, &bookUpdates, feed = static_cast<int>(feed), venue, venueId](const OrderBookUpdate& update) {
+            ++bookUpdates;
+            LatencyMonitor::recordExchangeToReceive(venue, update.exchangeTime, update.timestamp);
+            aggregator.updateBook(venueId, update);
+            bus.publish(feed, TopOfBook::from(venueId, update));
+        });
+    }
+    const int stateConsumer = bus.addConsumer("Market State", [&state, &dispatcher](const TopOfBook& top) {
+        applyMarketUpdate(state, dispatcher, top);
+    });
+    dispatcher.addSource([&bus, stateConsumer]() { return bus.poll(stateConsumer); });
+
+    applyFees(fees, scanner, cycles);
+
+    const VenueId binanceVenue = InstrumentRegistry::venueId("Binance");
+    binancePerp.watchSymbols(venueSymbols("", false, false));
+    binancePerp.setMarkPriceBatchCallback([&aggregator, &binancePerp, binanceVenue](const std::vector<MarkPriceEntry>& entries) {
+        for (const auto& e : entries) {
+            aggregator.updateFunding(binanceVenue, binancePerp.instrumentId(e.symbolId),
+                                     {e.markPrice, e.fundingRate, e.indexPrice, e.nextFundingTime});
+        }
+    });
+
+    NullBuffer nullBuffer;
+    std::streambuf* consoleBuffer = std::cout.rdbuf();
+    if (options.quiet) std::cout.rdbuf(&nullBuffer);
+
+    std::array<VenueStats, 5> venueStats{};
+    uint64_t unknownFrames = 0;
+    uint64_t parseErrors = 0;
+    int64_t firstRecordedNs = 0;
+    int64_t lastRecordedNs = 0;
+    int64_t passShiftNs = 0; // later passes continue the recorded clock instead of rewinding it
+
+    std::string payload; // reused: handlers take const std::string&
+    FeedRecord record;
+
+    const auto replayStart = std::chrono::steady_clock::now();
+
+    for (int loop = 0; loop < options.loops; ++loop) {
+        reader.rewind();
+        // Every pass starts from the journal's first frames, so the clients
+        // must not judge them against the previous pass's sequence ids
+        for (auto* client : clients) client->resetSequences();
+        if (loop > 0) passShiftNs = loop * (lastRecordedNs - firstRecordedNs + 1);
+
+        bool first = true;
+        int64_t loopStartNs = 0;
+        auto pacingStart = std::chrono::steady_clock::now();
+
+        while (reader.next(record)) {
+            if (first) {
+                loopStartNs = record.recvMonoNs;
+                if (loop == 0) firstRecordedNs = record.recvMonoNs;
+                first = false;
+            }
+            // Feed threads append concurrently, so timestamps can step back slightly
+            if (loop == 0) lastRecordedNs = std::max(lastRecordedNs, record.recvMonoNs);
+            const int64_t recordedNs = std::max(record.recvMonoNs, loopStartNs);
+
+            if (options.speed > 0.0) {
+                auto due = pacingStart + std::chrono::nanoseconds(
+                    static_cast<int64_t>((recordedNs - loopStartNs) / options.speed));
+                std::this_thread::sleep_until(due);
+            }
+
+            payload.assign(record.payload.data(), record.payload.size());
+            // Recorded receive times, so update timestamps match the live run
+            const ReceiveTime received{
+                Timestamp(std::chrono::duration_cast<Timestamp::duration>(std::chrono::nanoseconds(record.recvWallNs))),
+                MonoTimestamp(std::chrono::duration_cast<MonoTimestamp::duration>(std::chrono::nanoseconds(record.recvMonoNs + passShiftNs)))};
+
+            try {
+                switch (record.venue) {
+                    case FeedVenue::Binance: binance.handleIncomingMessage(payload, received); break;
+                    case FeedVenue::OKX: okx.handleIncomingMessage(payload, received); break;
+                    case FeedVenue::Bybit: bybit.handleIncomingMessage(payload, received); break;
+                    case FeedVenue::BinancePerp: binancePerp.handleIncomingMessage(payload, received); break;
+                    default: ++unknownFrames; continue;
+                }
+            } catch (const std::exception&) {
+                ++parseErrors;
+            }
+
+            auto& stats = venueStats[static_cast<size_t>(record.venue)];
+            ++stats.frames;
+            stats.bytes += record.payload.size();
+
+            // What the dispatcher thread would do once the frame's updates are on the bus
+            dispatcher.step(received.mono);
+        }
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - replayStart;
+    std::cout.rdbuf(consoleBuffer);
+
+    uint64_t totalFrames = 0;
+    uint64_t totalBytes = 0;
+    for (const auto& stats : venueStats) {
+        totalFrames += stats.frames;
+        totalBytes += stats.bytes;
+    }
+
+    const double recordedSeconds = (lastRecordedNs - firstRecordedNs) / 1e9;
+
+    std::cout << "\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+    std::cout << "⏪ FEED REPLAY SUMMARY\n";
+    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+    std::cout << "📼 Journal: " << options.path << " (" << options.loops << " pass(es), "
+              << std::fixed << std::setprecision(1) << recordedSeconds << " s recorded)\n";
+    for (size_t v = 1; v < venueStats.size(); ++v) {
+        if (venueStats[v].frames == 0) continue;
+        std::cout << "   " << std::left << std::setw(12) << feedVenueName(static_cast<FeedVenue>(v)) << std::right
+                  << venueStats[v].frames << " frames, " << (venueStats[v].bytes >> 10) << " KiB\n";
+    }
+    if (unknownFrames) std::cout << "⚠️ Unknown venue frames skipped: " << unknownFrames << "\n";
+    if (parseErrors) std::cout << "⚠️ Frames that threw while parsing: " << parseErrors << "\n";
+    std::cout << "📈 Book updates delivered: " << bookUpdates << "\n";
+    std::cout << "⏱️ Elapsed: " << std::setprecision(3) << elapsed.count() << " s | "
+              << std::setprecision(0) << totalFrames / elapsed.count() << " frames/s | "
+              << std::setprecision(1) << (totalBytes / 1048576.0) / elapsed.count() << " MiB/s\n";
+    if (totalFrames)
+        std::cout << "⚙️ Avg per frame (parse + bus + strategies): "
+                  << std::setprecision(0) << elapsed.count() * 1e9 / totalFrames << " ns\n";
+    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+
+    LatencyMonitor::printReport();
+    SequenceMonitor::printReport();
+    bus.printStats();
+    dispatcher.printStats();
+    synthetics.printStats();
+    cycles.printStats();
+    TradeExecutor::printPnLSummary();
+    return 0;
+}
@@ -0,0 +1,705 @@
+// Local stand-in for the Binance / OKX / Bybit public websocket streams, for
+// load-testing the ingestion path without touching the live venues.
+//
+//   mock_exchange [--port <n>] [--cert <pem>] [--key <pem>] [--rate <msgs/s>]
+//                 [--mark-rate <msgs/s>] [--perp-symbols <n>] [--journal <path>]
+//                 [--duration <s>]
+//
+// Point the engine at it with `arb_engine --endpoint wss://127.0.0.1:9443`.
+// The venue is chosen from the request path each client already uses:
+//
+//   /stream?streams=...    Binance spot combined bookTicker streams
+//   /ws/!markPrice@arr     Binance USD-M mark price array
+//   /ws/v5/public          OKX (books5 / books, subscribe handshake, checksums)
+//   /v5/public/linear      Bybit (orderbook.N, subscribe handshake, u sequence)
+//
+// Every connection gets its own synthetic random-walk books and is sent
+// --rate messages per second (0 = as fast as the socket drains). With
+// --journal, frames recorded by `arb_engine --record` are looped instead of
+// synthetic ones. The stats line reports the send rate and bytes still
+// buffered per venue: buffered bytes growing without bound means the
+// client side is saturated.
+//
+// TLS is required (the clients only speak wss). A self-signed pair is fine:
+//   openssl req -x509 -newkey rsa:2048 -nodes -days 365 -subj /CN=localhost
+//       -keyout certs/mock.key -out certs/mock.pem
+
+#include "exchange/OrderBook.hpp"
+#include "exchange/FeedJournal.hpp"
+#include <websocketpp/config/asio.hpp>
+#include <websocketpp/server.hpp>
+#include <asio/ssl.hpp>
+#include <asio/steady_timer.hpp>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+using json = nlohmann::json;
+using MockServer = websocketpp::server<websocketpp::config::asio_tls>;
+using websocketpp::connection_hdl;
+
+namespace {
+    struct MockOptions {
+        uint16_t port = 9443;
+        std::string certFile = "certs/mock.pem";
+        std::string keyFile = "certs/mock.key";
+        double rate = 1000.0;       // per connection; 0 = unthrottled
+        double markRate = 1.0;      // !markPrice@arr pushes per second
+        int perpSymbols = 300;      // array size, like the real stream
+        std::string journalPath;
+        int durationSeconds = 0;    // 0 = run until killed
+    };
+
+    enum class Dialect { BinanceSpot, BinancePerp, OKX, Bybit, Count };
+
+    const char* dialectName(Dialect d) {
+        switch (d) {
+            case Dialect::BinanceSpot: return "Binance";
+            case Dialect::BinancePerp: return "BinancePerp";
+            case Dialect::OKX: return "OKX";
+            case Dialect::Bybit: return "Bybit";
+            default: return "?";
+        }
+    }
+
+    constexpr auto TICK = std::chrono::milliseconds(1);
+    constexpr int PING_INTERVAL_TICKS = 20000;       // Binance pings every ~20 s
+    constexpr int STATS_INTERVAL_TICKS = 5000;
+    constexpr size_t UNTHROTTLED_BUFFER_LIMIT = 1 << 20;
+    constexpr size_t MAX_MESSAGES_PER_TICK = 2000;
+
+    double startingMid(const std::string& symbol) {
+        static const std::pair<const char*, double> mids[] = {
+            {"BTC", 108000.0}, {"ETH", 3800.0}, {"SOL", 180.0},
+            {"BNB", 700.0}, {"XRP", 2.5}, {"DOGE", 0.2},
+        };
+        for (const auto& [base, mid] : mids) {
+            if (symbol.rfind(base, 0) == 0) return mid;
+        }
+        return 100.0;
+    }
+
+    std::string upper(std::string s) {
+        std::transform(s.begin(), s.end(), s.begin(), ::toupper);
+        return s;
+    }
+
+    int64_t epochMillis() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    struct LevelChange {
+        std::string price;
+        std::string qty;
+    };
+
+    // Random-walk L2 book on an integer tick grid. Changes are emitted as
+    // text and mirrored into an OrderBook so OKX checksums come out exactly
+    // as the client will compute them.
+    class SyntheticBook {
+    public:
+        SyntheticBook(const std::string& symbol, size_t depth, uint32_t seed)
+            : symbol(symbol), depth(std::max<size_t>(depth, 1)), book(true), rng(seed) {
+            double mid = startingMid(upper(symbol));
+            int magnitude = static_cast<int>(std::floor(std::log10(mid)));
+            decimals = std::max(0, 6 - magnitude);
+            tickSize = std::pow(10.0, -decimals);
+            midTick = static_cast<int64_t>(std::llround(mid / tickSize));
+        }
+
+        // Rebuilds the full book; changes are the snapshot levels.
+        void snapshot(std::vector<LevelChange>& bids, std::vector<LevelChange>& asks) {
+            book.clear();
+            bids.clear();
+            asks.clear();
+            for (size_t i = 0; i < depth; ++i) {
+                set(OrderBook::Side::Bid, midTick - 1 - static_cast<int64_t>(i), randomQty(), bids);
+                set(OrderBook::Side::Ask, midTick + 1 + static_cast<int64_t>(i), randomQty(), asks);
+            }
+        }
+
+        // One small random delta: a size change near the touch, or the
+        // touch moving one tick up or down.
+        void step(std::vector<LevelChange>& bids, std::vector<LevelChange>& asks) {
+            bids.clear();
+            asks.clear();
+            if (book.empty()) {
+                snapshot(bids, asks);
+                return;
+            }
+
+            int64_t bidTick = toTick(book.bestBid().price);
+            int64_t askTick = toTick(book.bestAsk().price);
+            double r = unit(rng);
+
+            if (r < 0.5) {
+                auto side = unit(rng) < 0.5 ? OrderBook::Side::Bid : OrderBook::Side::Ask;
+                size_t i = static_cast<size_t>(unit(rng) * std::min<size_t>(book.depth(side), 10));
+                int64_t tick = toTick(book.level(side, i).price);
+                set(side, tick, randomQty(), side == OrderBook::Side::Bid ? bids : asks);
+            } else if (r < 0.75) {
+                if (askTick - bidTick > 1) set(OrderBook::Side::Bid, bidTick + 1, randomQty(), bids);
+                else set(OrderBook::Side::Ask, askTick, 0.0, asks);
+            } else {
+                if (askTick - bidTick > 1) set(OrderBook::Side::Ask, askTick - 1, randomQty(), asks);
+                else set(OrderBook::Side::Bid, bidTick, 0.0, bids);
+            }
+
+            rebalance(OrderBook::Side::Bid, bids);
+            rebalance(OrderBook::Side::Ask, asks);
+        }
+
+        const OrderBook& levels() const { return book; }
+        const std::string& name() const { return symbol; }
+        std::string text(double price) const { return format(price, decimals); }
+        std::string qtyText(double qty) const { return format(qty, 4); }
+
+    private:
+        static std::string format(double value, int precision) {
+            char buf[32];
+            int n = std::snprintf(buf, sizeof(buf), "%.*f", precision, value);
+            return std::string(buf, static_cast<size_t>(n));
+        }
+
+        int64_t toTick(double price) const { return static_cast<int64_t>(std::llround(price / tickSize)); }
+
+        double randomQty() { return 0.001 + unit(rng) * 5.0; }
+
+        void set(OrderBook::Side side, int64_t tick, double qty, std::vector<LevelChange>& out) {
+            LevelChange change{format(tick * tickSize, decimals), qty > 0.0 ? format(qty, 4) : "0"};
+            // Parse back from text so the mirror holds exactly what the client will see
+            book.apply(side, std::stod(change.price), std::stod(change.qty), change.price, change.qty);
+            out.push_back(std::move(change));
+        }
+
+        // Keeps each side at `depth` levels: drop the far end or extend it.
+        void rebalance(OrderBook::Side side, std::vector<LevelChange>& out) {
+            const int64_t away = side == OrderBook::Side::Bid ? -1 : 1;
+            while (book.depth(side) > depth) {
+                set(side, toTick(book.level(side, book.depth(side) - 1).price), 0.0, out);
+            }
+            while (book.depth(side) < depth) {
+                int64_t worst = book.depth(side) == 0
+                    ? toTick(side == OrderBook::Side::Bid ? book.bestAsk().price : book.bestBid().price)
+                    : toTick(book.level(side, book.depth(side) - 1).price);
+                set(side, worst + away, randomQty(), out);
+            }
+        }
+
+        std::string symbol;
+        size_t depth;
+        int decimals = 2;
+        double tickSize = 0.01;
+        int64_t midTick = 0;
+        OrderBook book;
+        std::mt19937 rng;
+        std::uniform_real_distribution<double> unit{0.0, 1.0};
+    };
+
+    struct Stream {
+        SyntheticBook book;
+        std::string channel;       // OKX channel or Bybit topic
+        uint64_t updateId = 0;     // Binance "u", Bybit "u"
+        bool snapshotPending = true;
+    };
+
+    struct Session {
+        Dialect dialect = Dialect::BinanceSpot;
+        std::vector<std::unique_ptr<Stream>> streams;
+        size_t nextStream = 0;
+        size_t journalCursor = 0;
+        double credit = 0.0;
+        double markCredit = 0.0;
+    };
+
+    struct DialectStats {
+        uint64_t sessions = 0;
+        uint64_t messages = 0;
+        uint64_t bytes = 0;
+        uint64_t buffered = 0;
+    };
+
+    void appendLevels(std::string& out, const std::vector<LevelChange>& levels, bool okxStyle) {
+        out += '[';
+        for (size_t i = 0; i < levels.size(); ++i) {
+            if (i) out += ',';
+            out += "[\"";
+            out += levels[i].price;
+            out += "\",\"";
+            out += levels[i].qty;
+            out += okxStyle ? "\",\"0\",\"1\"]" : "\"]";
+        }
+        out += ']';
+    }
+
+    // Current top `depth` levels of one side, best first.
+    void topLevels(const SyntheticBook& book, OrderBook::Side side, size_t depth, std::vector<LevelChange>& out) {
+        out.clear();
+        const auto& levels = book.levels();
+        size_t n = std::min(depth, levels.depth(side));
+        for (size_t i = 0; i < n; ++i) {
+            const auto& level = levels.level(side, i);
+            out.push_back({book.text(level.price), book.qtyText(level.qty)});
+        }
+    }
+
+    class MockExchange {
+    public:
+        explicit MockExchange(const MockOptions& options) : options(options), timer(io) {
+            loadJournal();
+
+            server.clear_access_channels(websocketpp::log::alevel::all);
+            server.set_error_channels(websocketpp::log::elevel::none);
+            server.init_asio(&io);
+            server.set_reuse_addr(true);
+
+            server.set_tls_init_handler([this](connection_hdl) {
+                auto ctx = std::make_shared<asio::ssl::context>(asio::ssl::context::tlsv12_server);
+                try {
+                    ctx->set_options(asio::ssl::context::default_workarounds |
+                                     asio::ssl::context::no_sslv2 |
+                                     asio::ssl::context::no_sslv3);
+                    ctx->use_certificate_chain_file(this->options.certFile);
+                    ctx->use_private_key_file(this->options.keyFile, asio::ssl::context::pem);
+                } catch (const std::exception& e) {
+                    std::cerr << "❌ TLS setup failed: " << e.what() << std::endl;
+                }
+                return ctx;
+            });
+
+            server.set_open_handler([this](connection_hdl hdl) { onOpen(hdl); });
+            server.set_close_handler([this](connection_hdl hdl) { sessions.erase(hdl); });
+            server.set_fail_handler([this](connection_hdl hdl) { sessions.erase(hdl); });
+            server.set_message_handler([this](connection_hdl hdl, MockServer::message_ptr msg) {
+                onMessage(hdl, msg->get_payload());
+            });
+        }
+
+        void run() {
+            websocketpp::lib::error_code ec;
+            server.listen(options.port, ec);
+            if (ec) {
+                std::cerr << "❌ Cannot listen on port " << options.port << ": " << ec.message() << std::endl;
+                return;
+            }
+            server.start_accept();
+            std::cout << "🧪 Mock exchange listening on wss://127.0.0.1:" << options.port
+                      << " (" << (options.rate > 0 ? std::to_string(static_cast<long long>(options.rate)) : "unthrottled")
+                      << " msgs/s per connection" << (journal.empty() ? ", synthetic" : ", recorded") << ")\n";
+
+            lastStats = std::chrono::steady_clock::now();
+            scheduleTick();
+            io.run();
+        }
+
+    private:
+        using SessionMap = std::map<connection_hdl, Session, std::owner_less<connection_hdl>>;
+
+        void loadJournal() {
+            if (options.journalPath.empty()) return;
+            FeedJournalReader reader(options.journalPath);
+            FeedRecord record;
+            while (reader.isOpen() && reader.next(record)) {
+                Dialect d;
+                switch (record.venue) {
+                    case FeedVenue::Binance: d = Dialect::BinanceSpot; break;
+                    case FeedVenue::BinancePerp: d = Dialect::BinancePerp; break;
+                    case FeedVenue::OKX: d = Dialect::OKX; break;
+                    case FeedVenue::Bybit: d = Dialect::Bybit; break;
+                    default: continue;
+                }
+                journal.resize(static_cast<size_t>(Dialect::Count));
+                journal[static_cast<size_t>(d)].emplace_back(record.payload);
+            }
+            std::cout << "📼 Loaded recorded frames from " << options.journalPath << "\n";
+        }
+
+        uint32_t nextSeed() { return seedCounter++ * 2654435761u + 7; }
+
+        void onOpen(connection_hdl hdl) {
+            auto con = server.get_con_from_hdl(hdl);
+            std::string resource = con->get_resource();
+
+            Session session;
+            if (resource.rfind("/stream", 0) == 0) {
+                session.dialect = Dialect::BinanceSpot;
+                // /stream?streams=btcusdt@bookTicker/ethusdt@bookTicker
+                auto pos = resource.find("streams=");
+                std::string list = pos == std::string::npos ? "" : resource.substr(pos + 8);
+                size_t start = 0;
+                while (start < list.size()) {
+                    size_t end = list.find('/', start);
+                    if (end == std::string::npos) end = list.size();
+                    std::string name = list.substr(start, end - start);
+                    std::string sym = name.substr(0, name.find('@'));
+                    auto stream = std::make_unique<Stream>(Stream{SyntheticBook(sym, 5, nextSeed()), name});
+                    session.streams.push_back(std::move(stream));
+                    start = end + 1;
+                }
+            } else if (resource.find("markPrice") != std::string::npos) {
+                session.dialect = Dialect::BinancePerp;
+                const char* watched[] = {"BTCUSDT", "ETHUSDT", "SOLUSDT", "XRPUSDT", "BNBUSDT", "DOGEUSDT"};
+                for (int i = 0; i < options.perpSymbols; ++i) {
+                    std::string sym = i < 6 ? watched[i] : "SYM" + std::to_string(i) + "USDT";
+                    session.streams.push_back(std::make_unique<Stream>(Stream{SyntheticBook(sym, 1, nextSeed()), sym}));
+                }
+            } else if (resource.find("/ws/v5/") != std::string::npos) {
+                session.dialect = Dialect::OKX;
+            } else if (resource.find("/v5/public/") != std::string::npos) {
+                session.dialect = Dialect::Bybit;
+            } else {
+                websocketpp::lib::error_code ec;
+                server.close(hdl, websocketpp::close::status::normal, "unknown stream", ec);
+                return;
+            }
+
+            std::cout << "🔌 " << dialectName(session.dialect) << " client connected (" << resource.substr(0, 60)
+                      << (resource.size() > 60 ? "..." : "") << ")\n";
+            sessions[hdl] = std::move(session);
+        }
+
+        void onMessage(connection_hdl hdl, const std::string& payload) {
+            auto it = sessions.find(hdl);
+            if (it == sessions.end()) return;
+            Session& session = it->second;
+
+            if (session.dialect == Dialect::OKX && payload == "ping") {
+                send(hdl, session, "pong");
+                return;
+            }
+
+            json request;
+            try {
+                request = json::parse(payload);
+            } catch (const std::exception&) {
+                return;
+            }
+            const std::string op = request.value("op", "");
+
+            if (session.dialect == Dialect::OKX && (op == "subscribe" || op == "unsubscribe")) {
+                for (const auto& arg : request.value("args", json::array())) {
+                    std::string channel = arg.value("channel", "");
+                    std::string instId = arg.value("instId", "");
+                    eraseStream(session, channel + ":" + instId);
+                    if (op == "subscribe") {
+                        size_t depth = channel == "books5" ? 5 : 50;
+                        session.streams.push_back(std::make_unique<Stream>(
+                            Stream{SyntheticBook(instId, depth, nextSeed()), channel + ":" + instId}));
+                    }
+                    json ack = {{"event", op}, {"arg", arg}, {"connId", "mock"}};
+                    send(hdl, session, ack.dump());
+                }
+            } else if (session.dialect == Dialect::Bybit && (op == "subscribe" || op == "unsubscribe")) {
+                for (const auto& topic : request.value("args", json::array())) {
+                    // orderbook.{depth}.{symbol}
+                    std::string name = topic.get<std::string>();
+                    eraseStream(session, name);
+                    if (op == "subscribe") {
+                        auto first = name.find('.');
+                        auto second = name.find('.', first + 1);
+                        if (first == std::string::npos || second == std::string::npos) continue;
+                        size_t depth = std::strtoul(name.substr(first + 1, second - first - 1).c_str(), nullptr, 10);
+                        session.streams.push_back(std::make_unique<Stream>(
+                            Stream{SyntheticBook(name.substr(second + 1), depth, nextSeed()), name}));
+                    }
+                }
+                json ack = {{"success", true}, {"ret_msg", ""}, {"conn_id", "mock"}, {"req_id", request.value("req_id", "")}, {"op", op}};
+                send(hdl, session, ack.dump());
+            } else if (session.dialect == Dialect::Bybit && op == "ping") {
+                json pong = {{"success", true}, {"ret_msg", "pong"}, {"conn_id", "mock"}, {"op", "ping"}};
+                send(hdl, session, pong.dump());
+            }
+        }
+
+        static void eraseStream(Session& session, const std::string& channel) {
+            auto& streams = session.streams;
+            streams.erase(std::remove_if(streams.begin(), streams.end(),
+                                         [&](const auto& s) { return s->channel == channel; }),
+                          streams.end());
+            session.nextStream = 0;
+        }
+
+        void send(connection_hdl hdl, Session& session, const std::string& payload) {
+            websocketpp::lib::error_code ec;
+            server.send(hdl, payload, websocketpp::frame::opcode::text, ec);
+            if (ec) return;
+            auto& stats = dialectStats[static_cast<size_t>(session.dialect)];
+            ++stats.messages;
+            stats.bytes += payload.size();
+        }
+
+        void scheduleTick() {
+            timer.expires_after(TICK);
+            timer.async_wait([this](const std::error_code& ec) {
+                if (ec) return;
+                onTick();
+                if (options.durationSeconds > 0 && ticks >= options.durationSeconds * 1000LL) {
+                    printStats();
+                    websocketpp::lib::error_code ignored;
+                    server.stop_listening(ignored);
+                    server.stop();
+                    return;
+                }
+                scheduleTick();
+            });
+        }
+
+        void onTick() {
+            ++ticks;
+            const double dt = std::chrono::duration<double>(TICK).count();
+
+            for (auto& [hdl, session] : sessions) {
+                if (session.streams.empty()) continue;
+                auto con = server.get_con_from_hdl(hdl);
+                if (!con) continue;
+
+                if (session.dialect == Dialect::BinancePerp) {
+                    session.markCredit += options.markRate * dt;
+                    while (session.markCredit >= 1.0) {
+                        session.markCredit -= 1.0;
+                        emit(hdl, session);
+                    }
+                } else if (options.rate > 0) {
+                    session.credit += options.rate * dt;
+                    size_t n = 0;
+                    while (session.credit >= 1.0 && n++ < MAX_MESSAGES_PER_TICK) {
+                        session.credit -= 1.0;
+                        emit(hdl, session);
+                    }
+                } else {
+                    size_t n = 0;
+                    while (con->get_buffered_amount() < UNTHROTTLED_BUFFER_LIMIT && n++ < MAX_MESSAGES_PER_TICK) {
+                        emit(hdl, session);
+                    }
+                }
+
+                if (ticks % PING_INTERVAL_TICKS == 0 &&
+                    (session.dialect == Dialect::BinanceSpot || session.dialect == Dialect::BinancePerp)) {
+                    websocketpp::lib::error_code ec;
+                    server.ping(hdl, "", ec);
+                }
+            }
+
+            if (ticks % STATS_INTERVAL_TICKS == 0) printStats();
+        }
+
+        // One outbound message for this session, synthetic or recorded.
+        void emit(connection_hdl hdl, Session& session) {
+            size_t d = static_cast<size_t>(session.dialect);
+            if (!journal.empty() && !journal[d].empty()) {
+                const auto& frames = journal[d];
+                send(hdl, session, frames[session.journalCursor]);
+                session.journalCursor = (session.journalCursor + 1) % frames.size();
+                return;
+            }
+
+            out.clear();
+            switch (session.dialect) {
+                case Dialect::BinanceSpot: buildBookTicker(session); break;
+                case Dialect::BinancePerp: buildMarkPriceArray(session); break;
+                case Dialect::OKX: buildOkxBook(session); break;
+                case Dialect::Bybit: buildBybitBook(session); break;
+                default: return;
+            }
+            if (!out.empty()) send(hdl, session, out);
+        }
+
+        Stream& nextStream(Session& session) {
+            Stream& stream = *session.streams[session.nextStream];
+            session.nextStream = (session.nextStream + 1) % session.streams.size();
+            return stream;
+        }
+
+        void buildBookTicker(Session& session) {
+            Stream& stream = nextStream(session);
+            stream.book.step(bidChanges, askChanges);
+            const auto& levels = stream.book.levels();
+            if (levels.empty()) return;
+
+            const std::string sym = upper(stream.book.name());
+            out += "{\"stream\":\"" + stream.channel + "\",\"data\":{\"u\":" + std::to_string(++stream.updateId);
+            out += ",\"s\":\"" + sym + "\"";
+            out += ",\"b\":\"" + stream.book.text(levels.bestBid().price) + "\"";
+            out += ",\"B\":\"" + stream.book.qtyText(levels.bestBid().qty) + "\"";
+            out += ",\"a\":\"" + stream.book.text(levels.bestAsk().price) + "\"";
+            out += ",\"A\":\"" + stream.book.qtyText(levels.bestAsk().qty) + "\"}}";
+        }
+
+        void buildMarkPriceArray(Session& session) {
+            const int64_t now = epochMillis();
+            const int64_t nextFunding = (now / 28800000 + 1) * 28800000; // 8h schedule
+            out += '[';
+            for (size_t i = 0; i < session.streams.size(); ++i) {
+                Stream& stream = *session.streams[i];
+                stream.book.step(bidChanges, askChanges);
+                const auto& levels = stream.book.levels();
+                if (levels.empty()) continue;
+                std::string mark = stream.book.text((levels.bestBid().price + levels.bestAsk().price) / 2.0);
+                if (out.size() > 1) out += ',';
+                out += "{\"e\":\"markPriceUpdate\",\"E\":" + std::to_string(now);
+                out += ",\"s\":\"" + stream.channel + "\",\"p\":\"" + mark + "\",\"P\":\"" + mark;
+                out += "\",\"i\":\"" + stream.book.text(levels.bestBid().price);
+                out += "\",\"r\":\"0.00010000\",\"T\":" + std::to_string(nextFunding) + "}";
+            }
+            out += ']';
+        }
+
+        void buildOkxBook(Session& session) {
+            Stream& stream = nextStream(session);
+            const auto colon = stream.channel.find(':');
+            const std::string channel = stream.channel.substr(0, colon);
+            const std::string instId = stream.channel.substr(colon + 1);
+            const bool books5 = channel == "books5";
+
+            bool snapshot = stream.snapshotPending || books5;
+            if (stream.snapshotPending) {
+                stream.book.snapshot(bidChanges, askChanges);
+                stream.snapshotPending = false;
+            } else {
+                stream.book.step(bidChanges, askChanges);
+            }
+            if (books5) {
+                // books5 always pushes the full top 5
+                topLevels(stream.book, OrderBook::Side::Bid, 5, bidChanges);
+                topLevels(stream.book, OrderBook::Side::Ask, 5, askChanges);
+            }
+
+            const int64_t seqId = static_cast<int64_t>(++stream.updateId);
+            out += "{\"arg\":{\"channel\":\"" + channel + "\",\"instId\":\"" + instId + "\"}";
+            if (!books5) out += snapshot ? ",\"action\":\"snapshot\"" : ",\"action\":\"update\"";
+            out += ",\"data\":[{\"asks\":";
+            appendLevels(out, askChanges, true);
+            out += ",\"bids\":";
+            appendLevels(out, bidChanges, true);
+            out += ",\"ts\":\"" + std::to_string(epochMillis()) + "\"";
+            if (!books5) out += ",\"checksum\":" + std::to_string(stream.book.levels().okxChecksum());
+            out += ",\"prevSeqId\":" + std::to_string(snapshot ? -1 : seqId - 1);
+            out += ",\"seqId\":" + std::to_string(seqId) + "}]}";
+        }
+
+        void buildBybitBook(Session& session) {
+            Stream& stream = nextStream(session);
+            const bool snapshot = stream.snapshotPending;
+            if (snapshot) {
+                stream.book.snapshot(bidChanges, askChanges);
+                stream.snapshotPending = false;
+                stream.updateId = 1;
+            } else {
+                stream.book.step(bidChanges, askChanges);
+                ++stream.updateId;
+            }
+
+            const std::string ts = std::to_string(epochMillis());
+            out += "{\"topic\":\"" + stream.channel + "\",\"type\":\"" + (snapshot ? "snapshot" : "delta") + "\"";
+            out += ",\"ts\":" + ts;
+            out += ",\"data\":{\"s\":\"" + stream.book.name() + "\",\"b\":";
+            appendLevels(out, bidChanges, false);
+            out += ",\"a\":";
+            appendLevels(out, askChanges, false);
+            out += ",\"u\":" + std::to_string(stream.updateId);
+            out += ",\"seq\":" + std::to_string(stream.updateId) + "},\"cts\":" + ts + "}";
+        }
+
+        void printStats() {
+            auto now = std::chrono::steady_clock::now();
+            double seconds = std::chrono::duration<double>(now - lastStats).count();
+            lastStats = now;
+
+            for (auto& stats : dialectStats) {
+                stats.sessions = 0;
+                stats.buffered = 0;
+            }
+            for (const auto& [hdl, session] : sessions) {
+                auto& stats = dialectStats[static_cast<size_t>(session.dialect)];
+                ++stats.sessions;
+                if (auto con = server.get_con_from_hdl(hdl)) stats.buffered += con->get_buffered_amount();
+            }
+
+            std::cout << "📊 Mock exchange:";
+            for (size_t d = 0; d < dialectStats.size(); ++d) {
+                auto& stats = dialectStats[d];
+                if (stats.sessions == 0 && stats.messages == 0) continue;
+                std::cout << " | " << dialectName(static_cast<Dialect>(d)) << " x" << stats.sessions << ": "
+                          << std::fixed << std::setprecision(0) << stats.messages / seconds << " msg/s, "
+                          << std::setprecision(2) << stats.bytes / seconds / 1048576.0 << " MiB/s, "
+                          << (stats.buffered >> 10) << " KiB buffered";
+                stats.messages = 0;
+                stats.bytes = 0;
+            }
+            std::cout << std::endl;
+        }
+
+        MockOptions options;
+        asio::io_context io;
+        asio::steady_timer timer;
+        MockServer server;
+        SessionMap sessions;
+
+        std::vector<std::vector<std::string>> journal; // dialect -> recorded frames
+        std::array<DialectStats, static_cast<size_t>(Dialect::Count)> dialectStats{};
+        std::chrono::steady_clock::time_point lastStats;
+        int64_t ticks = 0;
+        uint32_t seedCounter = 1;
+
+        // Scratch buffers reused for every message
+        std::string out;
+        std::vector<LevelChange> bidChanges;
+        std::vector<LevelChange> askChanges;
+    };
+
+    void printUsage() {
+        std::cout << "Usage: mock_exchange [--port <n>] [--cert <pem>] [--key <pem>] [--rate <msgs/s>]\n"
+                     "                     [--mark-rate <msgs/s>] [--perp-symbols <n>] [--journal <path>] [--duration <s>]\n";
+    }
+
+    bool parseOptions(int argc, char** argv, MockOptions& options) {
+        for (int i = 1; i < argc; ++i) {
+            if (i + 1 >= argc) return false;
+            const char* flag = argv[i];
+            const char* value = argv[++i];
+            if (std::strcmp(flag, "--port") == 0) options.port = static_cast<uint16_t>(std::atoi(value));
+            else if (std::strcmp(flag, "--cert") == 0) options.certFile = value;
+            else if (std::strcmp(flag, "--key") == 0) options.keyFile = value;
+            else if (std::strcmp(flag, "--rate") == 0) options.rate = std::strtod(value, nullptr);
+            else if (std::strcmp(flag, "--mark-rate") == 0) options.markRate = std::strtod(value, nullptr);
+            else if (std::strcmp(flag, "--perp-symbols") == 0) options.perpSymbols = std::max(1, std::atoi(value));
+            else if (std::strcmp(flag, "--journal") == 0) options.journalPath = value;
+            else if (std::strcmp(flag, "--duration") == 0) options.durationSeconds = std::atoi(value);
+            else return false;
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    MockOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    MockExchange exchange(options);
+    exchange.run();
+    return 0;
+}